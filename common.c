@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <ctype.h>
 
 static int setbootcounter_emmc(unsigned char val);
 static int setbootcounter_nvram(unsigned char val);
@@ -30,6 +33,165 @@ int atoi_s(char *s, int *val)
         return 0;
 }
 
+/***********************************************************************************************************
+ Kernel command line: read whole and split into key=value parameters once, then looked up from the table.
+ Quoted values ("key=a b") are kept together, as the kernel does. A PSPLASH_<KEY> environment variable
+ (key uppercased, '-' and '.' turned into '_') overrides the parameter of the same name.
+ ***********************************************************************************************************/
+#define CMDLINE_ENV_PREFIX "PSPLASH_"
+
+typedef struct CmdlineParam
+{
+  const char* key;
+  const char* value;    // "" for a bare flag
+} CmdlineParam;
+
+static char*         cmdline_buf;
+static CmdlineParam* cmdline_params;
+static int           cmdline_nparams;
+static int           cmdline_state;    // 0: not loaded yet, 1: loaded, -1: unreadable
+
+// Reads the whole file, however long
+static char* cmdline_read(const char* path)
+{
+  size_t size = 1024, len = 0;
+  ssize_t n;
+  char* buf = malloc(size);
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+  if (fd < 0 || buf == NULL)
+    goto fail;
+
+  while ((n = read(fd, buf + len, size - len - 1)) > 0)
+  {
+    len += n;
+    if (len + 1 == size)
+    {
+      char* bigger = realloc(buf, size * 2);
+      if (bigger == NULL)
+        goto fail;
+      buf = bigger;
+      size *= 2;
+    }
+  }
+
+  if (n < 0)
+    goto fail;
+
+  close(fd);
+  buf[len] = '\0';
+  return buf;
+
+fail:
+  if (fd >= 0)
+    close(fd);
+  free(buf);
+  return NULL;
+}
+
+int cmdline_load()
+{
+  char *p, *out;
+  int max = 0;
+
+  if (cmdline_state != 0)
+    return (cmdline_state > 0) ? 0 : -1;
+
+  if ((cmdline_buf = cmdline_read(CMDLINEPATH "cmdline")) == NULL)
+  {
+    fprintf(stderr,"Cannot read kernel command line -> %scmdline \n", CMDLINEPATH);
+    cmdline_state = -1;
+    return -1;
+  }
+
+  // Parameters are split in place: each one ends up NUL terminated, without its quotes
+  for (p = cmdline_buf; *p; )
+  {
+    char* start;
+    int quoted = 0;
+
+    while (*p == ' ' || *p == '\t' || *p == '\n')
+      p++;
+    if (*p == '\0')
+      break;
+
+    for (start = out = p; *p && (quoted || (*p != ' ' && *p != '\t' && *p != '\n')); p++)
+    {
+      if (*p == '"')
+        quoted = !quoted;
+      else
+        *out++ = *p;
+    }
+    if (*p)
+      p++;
+    *out = '\0';
+
+    if (cmdline_nparams == max)
+    {
+      CmdlineParam* bigger = realloc(cmdline_params, (max ? max * 2 : 32) * sizeof(CmdlineParam));
+      if (bigger == NULL)
+        break;
+      cmdline_params = bigger;
+      max = max ? max * 2 : 32;
+    }
+
+    cmdline_params[cmdline_nparams].key = start;
+    if ((out = strchr(start, '=')) != NULL)
+    {
+      *out = '\0';
+      cmdline_params[cmdline_nparams].value = out + 1;
+    }
+    else
+      cmdline_params[cmdline_nparams].value = "";
+    cmdline_nparams++;
+  }
+
+  cmdline_state = 1;
+  return 0;
+}
+
+const char* cmdline_get(const char* key)
+{
+  char env[128];
+  const char* value;
+  int i;
+
+  snprintf(env, sizeof(env), CMDLINE_ENV_PREFIX "%s", key);
+  for (i = strlen(CMDLINE_ENV_PREFIX); env[i]; i++)
+    env[i] = (env[i] == '-' || env[i] == '.') ? '_' : toupper((unsigned char) env[i]);
+
+  if ((value = getenv(env)) != NULL)
+    return value;
+
+  if (cmdline_load())
+    return NULL;
+
+  // The last one wins, as for most kernel parameters
+  for (i = cmdline_nparams - 1; i >= 0; i--)
+    if (!strcmp(cmdline_params[i].key, key))
+      return cmdline_params[i].value;
+
+  return NULL;
+}
+
+int cmdline_get_int(const char* key, int* value)
+{
+  const char* str = cmdline_get(key);
+  char* end;
+  long l;
+
+  if (str == NULL || *str == '\0')
+    return -1;
+
+  errno = 0;
+  l = strtol(str, &end, 10);
+  if (*end != '\0' || errno == ERANGE || l > INT_MAX || l < INT_MIN)
+    return -1;
+
+  *value = (int) l;
+  return 0;
+}
+
 int gethwcode()
 {
   static int hw_code = -1;
@@ -39,19 +201,8 @@ int gethwcode()
       return hw_code;
 
   int hc = -1;
-  char cmdline[MAXPATHLENGTH];
 
-  memset(cmdline, 0, MAXPATHLENGTH);
-  if (sysfs_read(CMDLINEPATH,"cmdline",cmdline,MAXPATHLENGTH-1))
-    return -1;
-  char * pch;
-
-  pch = strstr(cmdline, "hw_code=") + strlen("hw_code=");
-  if (pch == NULL)
-    return -1;
-
-  // NOLINTNEXTLINE(cert-err34-c) safe because argument comes from sysfs
-  if (sscanf (pch,"%d %*s", &hc) < 1)
+  if (cmdline_get_int("hw_code", &hc))
     return -1;
 
   hw_code = hc;
@@ -69,19 +220,8 @@ int gettouchtype()
       return touch_type;
 
   int hc = -1;
-  char cmdline[MAXPATHLENGTH];
-
-  memset(cmdline, 0, MAXPATHLENGTH);
-  if (sysfs_read(CMDLINEPATH,"cmdline",cmdline,MAXPATHLENGTH-1))
-    return -1;
-  char * pch;
 
-  pch = strstr(cmdline, "touch_type=") + strlen("touch_type=");
-  if (pch == NULL)
-    return -1;
-
-  // NOLINTNEXTLINE(cert-err34-c) safe because argument comes from sysfs
-  if (sscanf (pch,"%d %*s", &hc) < 1)
+  if (cmdline_get_int("touch_type", &hc))
     return -1;
 
   touch_type = hc;
@@ -108,61 +248,107 @@ int setbootcounter(unsigned char val)
 }
 
 /***********************************************************************************************************
- Set the bootcounter (in eMMC) to the specified value
+ Bootcounter update: the magic byte followed by the counter value.
+ The current value is read first, so that nothing is written (no eMMC wear, no write latency) when it already
+ holds val, and the eMMC write protection is only lifted when it is actually on.
  ***********************************************************************************************************/
-#define BOOT1DEVICE                      "/dev/mmcblk1boot1"
-#define BOOT1ROSYSFS                     "/sys/block/mmcblk1boot1/force_ro"
-static int setbootcounter_emmc(unsigned char val)
+#define BOOTCOUNTER_MAGIC 0xbc
+
+static int force_ro_get(const char* path)
 {
-  #define BC_MAGIC 0xbc
-  unsigned char buff[2];
+  char c;
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
 
-  buff[0] = BC_MAGIC;
-  buff[1] = val;
+  if (fd < 0)
+    return -1;
+
+  if (read(fd, &c, 1) != 1)
+    c = '1';
+  close(fd);
+
+  return c != '0';
+}
+
+static int force_ro_set(const char* path, int ro)
+{
+  int fd = open(path, O_WRONLY | O_CLOEXEC);
+  int ret = -1;
+
+  if (fd < 0)
+    return -1;
+
+  if (write(fd, ro ? "1" : "0", 1) == 1)
+    ret = 0;
+  close(fd);
 
-  FILE* sysfs_ro = fopen(BOOT1ROSYSFS, "w");
-  FILE* fp = fopen(BOOT1DEVICE, "wb");
+  return ret;
+}
+
+static int bootcounter_update(const char* device, off_t offset, const char* force_ro, unsigned char val)
+{
+  unsigned char buff[2], cur[2];
+  int fd, ro = 0, ret = -1;
 
-  if(fp == NULL || sysfs_ro == NULL)
+  buff[0] = BOOTCOUNTER_MAGIC;
+  buff[1] = val;
+
+  if ((fd = open(device, O_RDONLY | O_CLOEXEC)) >= 0)
   {
-    fprintf(stderr,"setbootcounter cannot open file -> %s \n",BOOT1DEVICE);
-    goto err;
+    ssize_t n = pread(fd, cur, 2, offset);
+
+    close(fd);
+    if (n == 2 && cur[0] == buff[0] && cur[1] == buff[1])
+      return 0;
   }
 
-  if (fseek(fp, 0x80000, SEEK_SET))
+  if (force_ro)
   {
-    fprintf(stderr,"setbootcounter cannot open file -> %s \n",BOOT1DEVICE);
-    goto err;
+    if ((ro = force_ro_get(force_ro)) < 0)
+    {
+      fprintf(stderr,"setbootcounter cannot open file -> %s \n",force_ro);
+      return -1;
+    }
+
+    if (ro && force_ro_set(force_ro, 0))
+    {
+      fprintf(stderr,"setbootcounter failed making writeable\n");
+      return -1;
+    }
   }
 
-  if (fputs("0", sysfs_ro) == EOF) {
-    fprintf(stderr,"setbootcounter failed making writeable\n");
-    goto err;
+  if ((fd = open(device, O_WRONLY | O_CLOEXEC)) < 0)
+  {
+    fprintf(stderr,"setbootcounter cannot open file -> %s \n",device);
+    goto restore;
   }
-  (void) fflush(sysfs_ro);
 
-  if (fwrite(buff,1,2,fp) < 2) {
+  if (pwrite(fd, buff, 2, offset) != 2)
     fprintf(stderr,"setbootcounter failed write\n");
-    (void) fclose(fp); fp = NULL;
-    goto err;
-  }
-  (void) fflush(fp);
-  (void) fclose(fp); fp = NULL;
-
-  if (fputs("1", sysfs_ro) == EOF) {
+  // Some devices (e.g. the sysfs nvram) have nothing to sync
+  else if (fdatasync(fd) && errno != EINVAL)
+    fprintf(stderr,"setbootcounter failed sync\n");
+  else
+    ret = 0;
+  close(fd);
+
+restore:
+  if (ro && force_ro_set(force_ro, 1))
+  {
     fprintf(stderr,"setbootcounter failed making readonly\n");
-    goto err;
+    ret = -1;
   }
-  (void) fflush(sysfs_ro);
-  (void) fclose(sysfs_ro); sysfs_ro = NULL;
 
-  return 0;
-err:
-  if (fp)
-      (void) fclose(fp);
-  if (sysfs_ro)
-      (void) fclose(sysfs_ro);
-  return -1;
+  return ret;
+}
+
+/***********************************************************************************************************
+ Set the bootcounter (in eMMC) to the specified value
+ ***********************************************************************************************************/
+#define BOOT1DEVICE                      "/dev/mmcblk1boot1"
+#define BOOT1ROSYSFS                     "/sys/block/mmcblk1boot1/force_ro"
+static int setbootcounter_emmc(unsigned char val)
+{
+  return bootcounter_update(BOOT1DEVICE, 0x80000, BOOT1ROSYSFS, val);
 }
 
 /***********************************************************************************************************
@@ -171,29 +357,7 @@ err:
 #define NVRAMDEVICE                      "/sys/class/rtc/rtc0/device/nvram"
 static int setbootcounter_nvram(unsigned char val)
 {
-  #define NVRAM_MAGIC 0xbc
-  unsigned char buff[2];
-  
-  buff[0] = NVRAM_MAGIC;
-  buff[1] = val;
-  
-  // Opens the nvram device and updates the bootcounter
-  FILE* fp;
-  if((fp = fopen(NVRAMDEVICE, "w"))==NULL)
-  {
-    fprintf(stderr,"setbootcounter cannot open file -> %s \n",NVRAMDEVICE);
-    return -1;
-  }
-  
-  if (fwrite(buff,1,2,fp) < 2) {
-    fprintf(stderr,"setbootcounter failed write\n");
-    (void) fclose(fp);
-    return -1;
-  }
-  (void) fflush(fp); //Just in case ... but not really needed
-  (void) fclose(fp);
-  
-  return 0;
+  return bootcounter_update(NVRAMDEVICE, 0, NULL, val);
 }
 
 //Helper function for reading a parameter from sysfs
@@ -73,6 +73,12 @@
 
 int atoi_s(char *s, int *val);
 
+// Kernel command line parameters (see common.c): cmdline_get() returns the value of key,
+// "" for a bare flag, NULL if absent; cmdline_get_int() returns 0 when key holds an integer
+int cmdline_load();
+const char* cmdline_get(const char* key);
+int cmdline_get_int(const char* key, int* value);
+
 int gethwcode();
 int gettouchtype();
 int setbootcounter(unsigned char val);
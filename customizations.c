@@ -24,13 +24,19 @@
 #include "psplash.h"
 #include "psplash-fb.h"
 #include "customizations.h"
+#include "psplash-pool.h"
+#include "sysparams.h"
 #include <linux/i2c-dev.h>
 #include <dirent.h>
 #include <linux/input.h>
+#include <sys/inotify.h>
 #include "settings-img.h"
 #include "configos-img.h"
 #include "calib-img.h"
 #include <math.h>
+#include <time.h>
+#include <spawn.h>
+#include <sys/wait.h>
 
 #define SPLASH_HDRLEN         56
 #define SPLASH_STRIDE_IDX     0
@@ -47,6 +53,7 @@
 #define I2CSEEPROMDEVICE                 "/sys/class/i2c-dev/"SEEPROM_I2C_BUS"/device/"SEEPROM_I2C_ADDRESS"/eeprom"
 #define BLDIMM_POS                       128
 
+#define INPUTDEVICEDIR                   "/dev/input"
 #define DEFAULT_TOUCH_EVENT0             "/dev/input/event0"
 #define DEFAULT_TOUCH_EVENT1             "/dev/input/event1"
 #define DEFAULT_TOUCH_EVENT2             "/dev/input/event2"
@@ -57,23 +64,112 @@
 /***********************************************************************************************************
  STATIC HELPER FUNCTIONS
  ***********************************************************************************************************/
-// Helper function to read a system parameter system.ini file
-static int getSystemParameter(const char* key, char* value)
+// Signal mask psplash was started with. psplash blocks the signals its main loop handles in every thread,
+// but the commands run from here must get them as usual, e.g. to be interrupted if they hang.
+static sigset_t spawn_sigmask;
+static int      spawn_sigmask_valid = 0;
+
+void Spawn_set_sigmask(const sigset_t* mask)
 {
+  spawn_sigmask = *mask;
+  spawn_sigmask_valid = 1;
+}
+
+// Helper function to start a shell command with the original signal mask and default signal actions.
+// If out_fd is not NULL, it gets the read end of the command's stdout. Returns the child pid, -1 on failure.
+static pid_t spawncmd(const char* cmd, int* out_fd)
+{
+  posix_spawnattr_t attr;
+  posix_spawn_file_actions_t actions;
+  sigset_t all;
+  char* argv[] = { "sh", "-c", (char*) cmd, NULL };
+  int pipefd[2] = { -1, -1 };
+  pid_t pid;
+  int err;
+
+  if (out_fd && pipe2(pipefd, O_CLOEXEC))
+    return -1;
+
+  posix_spawnattr_init(&attr);
+  posix_spawn_file_actions_init(&actions);
+
+  sigfillset(&all);
+  posix_spawnattr_setsigdefault(&attr, &all);
+  if (spawn_sigmask_valid)
+  {
+    posix_spawnattr_setsigmask(&attr, &spawn_sigmask);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+  }
+  else
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF);
+
+  if (out_fd)
+    posix_spawn_file_actions_adddup2(&actions, pipefd[1], STDOUT_FILENO);
+
+  err = posix_spawn(&pid, "/bin/sh", &actions, &attr, argv, environ);
+
+  posix_spawn_file_actions_destroy(&actions);
+  posix_spawnattr_destroy(&attr);
+
+  if (out_fd)
+    close(pipefd[1]);
+
+  if (err)
+  {
+    if (out_fd)
+      close(pipefd[0]);
+    return -1;
+  }
+
+  if (out_fd)
+    *out_fd = pipefd[0];
+  return pid;
+}
+
+// Helper function to wait for a command started by spawncmd(), returns its wait status or -1
+static int waitcmd(pid_t pid)
+{
+  int status;
+
+  while (waitpid(pid, &status, 0) < 0)
+    if (errno != EINTR)
+      return -1;
+
+  return status;
+}
+
+// Helper function to read a system parameter from the system.ini file.
+// The store is parsed in-process; sys_params is only run when it is not available
+// or lacks the key, since sys_params supplies the defaults of missing ones.
+static int getSystemParameter(const char* key, char* value, int n)
+{
+
+  if (sysparams_load() == 0 && sysparams_get(key, value, n) == 0)
+    return 0;
 
   char cmd[256];
   snprintf(cmd, sizeof(cmd), "%s%s", SYSPARAMS_CMD, key);
 
-  // NOLINTNEXTLINE(cert-env33-c) not insecure as long as passed fixed input
-  FILE* pipe = popen(cmd, "r");
-  if (!pipe)
+  int fd;
+  pid_t pid = spawncmd(cmd, &fd);
+  if (pid < 0)
     return -1;
 
-  if ( fgets(value, sizeof(value), pipe) == NULL) {
-    pclose(pipe);
+  FILE* pipe = fdopen(fd, "r");
+  if (!pipe) {
+    close(fd);
+    waitcmd(pid);
     return -1;
   }
 
+  if ( fgets(value, n, pipe) == NULL) {
+    fclose(pipe);
+    waitcmd(pid);
+    return -1;
+  }
+
+  fclose(pipe);
+  waitcmd(pid);
   return 0;
 }
 
@@ -82,7 +178,7 @@ static int getSystemParameterInt(const char* key, int* value)
 
   char strValue[128];
   char* end;
-  if ( getSystemParameter(key, strValue) < 0 )
+  if ( getSystemParameter(key, strValue, sizeof(strValue)) < 0 )
       return -1;
 
   *value = (int) strtol(strValue, &end, 10);
@@ -97,16 +193,19 @@ static int getSystemParameterInt(const char* key, int* value)
 static void Draw_Icon(PSplashFB *fb, int iconw, int iconh, uint8* data, uint8 bkred, uint8 bkgreen, uint8 bkblue)
 {
   #define ICONYPOS 100
-  psplash_fb_draw_rect (fb, 0, (fb->width - iconw)/2, ICONYPOS, iconw, iconh, bkred, bkgreen, bkblue);
+  psplash_fb_draw_rect (fb, 1, (fb->width - iconw)/2, ICONYPOS, iconw, iconh, bkred, bkgreen, bkblue);
 
   psplash_fb_draw_image (fb,
-			 0,
+			 1,
 			 (fb->width - iconw)/2,
 			 ICONYPOS,
 			 iconw,
 			 iconh,
 			 SETTINGS_IMG_BYTES_PER_PIXEL,
 			 data);
+
+  // Drawn in the back buffer like the rest, so that it survives a repaint
+  psplash_fb_flush_rect (fb, (fb->width - iconw)/2, ICONYPOS, iconw, iconh);
 }
 
 //Helper function to write the synchornization file with the JMloader
@@ -143,9 +242,12 @@ static int SyncJMLauncher(char* msg)
 static int systemcmd(const char* cmd)
 {
   int ret;
+  pid_t pid;
+
+  if ((pid = spawncmd(cmd, NULL)) < 0)
+    return -1;
 
-  // NOLINTNEXTLINE(cert-env33-c) not insecure as long as passed fixed input
-  ret = system(cmd);
+  ret = waitcmd(pid);
   if (ret == -1)
     return ret;	// Failed to execute the system function
 
@@ -189,25 +291,22 @@ static int get_brightness_from_seeprom()
 }
 
 
-//Sets the brightness value as desired (without saving to i2c SEEPROM)
-static int SetBrightness(char* brightnessdevice, int* pval)
-{
-  char strval[50];
-
-  sprintf (strval,"%d", *pval);
-  sysfs_write(brightnessdevice,"brightness",strval);
-  return 0;
-}
-
 /***********************************************************************************************************
- Drawing the custom splashimage from splashimage.bin file
- NOTE: In order to speed up loading time, it is nedeed that both framebuffer and splashimage are in RGB565
-       format.
+ Loading the custom splashimage from splashimage.bin file
+ NOTE: The image is only read into memory here (this is the slow part, since the splash partition has to be
+       mounted first), so that it can be done while the framebuffer is still being set up.
 ***********************************************************************************************************/
-int psplash_draw_custom_splashimage(PSplashFB *fb)
+static uint16*      splash_data = NULL;
+static unsigned int splash_width;
+static unsigned int splash_rows;
+
+int psplash_load_custom_splashimage()
 {
   char * splashpartition; //Partition containing the splashimage.bin file
 
+  if (splash_data)
+    return 0;
+
   // Get the splash partition from the environment or use the default partition
   splashpartition = getenv("SPLASHPARTITION");
   if (splashpartition == NULL)
@@ -233,10 +332,7 @@ int psplash_draw_custom_splashimage(PSplashFB *fb)
   }
 
   // Gets the header of the SPLASH image and calculates the dimensions of the stored image. performs sanity checks
-  unsigned int  splash_width;
   unsigned int  splash_height;
-  unsigned int  splash_posx = 0;
-  unsigned int  splash_posy = 0;
   unsigned int  header[SPLASH_HDRLEN];
 
   rewind(fp);
@@ -249,7 +345,7 @@ int psplash_draw_custom_splashimage(PSplashFB *fb)
 
   splash_width = (header[SPLASH_STRIDE_IDX]) / 2 + 1;
 
-  if ((splash_width > fb->width) || (splash_width < 10))
+  if (splash_width < 10)
   {
     fprintf(stderr,"psplash: splashimage width error: %d \n",splash_width);
     goto error;
@@ -257,18 +353,54 @@ int psplash_draw_custom_splashimage(PSplashFB *fb)
 
   splash_height = (((header[SPLASH_SIZE_IDX]) / 2) / splash_width);
 
-  if (splash_height > (fb->height)) splash_height = (fb->height);
   if (splash_height < 10)
   {
     fprintf(stderr,"psplash: splashimage height error: %d \n",splash_height);
     goto error;
   }
 
-  // calculates the position of the splash inside the display
-  splash_posx = ((fb->width)  - splash_width ) / 2;
-  splash_posy = ((fb->height) - splash_height) / 2;
+  splash_data = (uint16 *) malloc (2 * splash_width * splash_height);
+  if (splash_data==NULL)
+  {
+    fprintf(stderr,"psplash: malloc error\n");
+    goto error;
+  }
+
+  // Truncated files are drawn up to the last complete row
+  splash_rows = fread(splash_data, 2 * splash_width, splash_height, fp);
+
+  (void) fclose(fp);
+  // UnMount the splash partition
+  // systemcmd(umount_cmd);
+
+  return 0;
 
-  //And now draws the splashimage
+error:
+  if(fp)
+    (void) fclose(fp);
+  // UnMount the splash partition
+  // systemcmd(umount_cmd);
+
+  return -1;
+}
+
+/***********************************************************************************************************
+ Drawing the custom splashimage from splashimage.bin file
+ NOTE: In order to speed up loading time, it is nedeed that both framebuffer and splashimage are in RGB565
+       format.
+***********************************************************************************************************/
+typedef struct SplashBandJob
+{
+  PSplashFB*   fb;
+  int          buffered;
+  unsigned int posx;
+  unsigned int posy;
+  unsigned int width;
+} SplashBandJob;
+
+static void draw_splash_band(void *data, int y0, int y1)
+{
+  SplashBandJob* job = data;
   int          x;
   int          y;
   uint8        red;
@@ -277,42 +409,52 @@ int psplash_draw_custom_splashimage(PSplashFB *fb)
   uint16*      stride;
   uint16       rgb565color;
 
-  stride = (uint16 *) malloc (2 * (splash_width + 1));
-  if (stride==NULL)
+  for(y=y0; y<y1; y++)
   {
-    fprintf(stderr,"psplash: malloc error\n");
-    goto error;
-  }
+    stride = splash_data + y * job->width;
 
-  for(y=0; y<splash_height; y++)
-  {
-    if (fread(stride, 2 * splash_width, 1, fp) != 1)
-        continue;
-        
-    for(x=0; x<splash_width; x++)
+    for(x=0; x<job->width; x++)
     {
       rgb565color = stride[x];
       blue  = (uint8)((rgb565color << 3) & 0x00ff);
       green = (uint8)((rgb565color >> 3) & 0x00ff);
       red   = (uint8)((rgb565color >>8) & 0x00ff);
-      psplash_fb_plot_pixel (fb, 0, splash_posx + x, splash_posy + y, red, green, blue);
+      psplash_fb_plot_pixel (job->fb, job->buffered, job->posx + x, job->posy + y, red, green, blue);
     }
   }
+}
 
-  free(stride);
-  (void) fclose(fp);
-  // UnMount the splash partition
-  // systemcmd(umount_cmd);
+int psplash_draw_custom_splashimage(PSplashFB *fb, int buffered)
+{
+  unsigned int  splash_height;
+  unsigned int  splash_posx = 0;
+  unsigned int  splash_posy = 0;
 
-  return 0;
+  if (psplash_load_custom_splashimage())
+    return -1;
 
-error:
-  if(fp)
-    (void) fclose(fp);
-  // UnMount the splash partition
-  // systemcmd(umount_cmd);
+  if (splash_width > fb->width)
+  {
+    fprintf(stderr,"psplash: splashimage width error: %d \n",splash_width);
+    return -1;
+  }
 
-  return -1;
+  splash_height = splash_rows;
+  if (splash_height > (fb->height)) splash_height = (fb->height);
+
+  // calculates the position of the splash inside the display
+  splash_posx = ((fb->width)  - splash_width ) / 2;
+  splash_posy = ((fb->height) - splash_height) / 2;
+
+  //And now draws the splashimage, split in bands over the available cores
+  SplashBandJob job = { fb, buffered, splash_posx, splash_posy, splash_width };
+
+  psplash_pool_run (splash_width, splash_height, draw_splash_band, &job);
+
+  free(splash_data);
+  splash_data = NULL;
+
+  return 0;
 }
 
 /*! Apply gamma correction to dim light below physical backlight minimum value */
@@ -395,7 +537,15 @@ struct mxcfb_csc_matrix {
 
 #define MXCFB_CSC_UPDATE_LCD	_IOW('F', 0x3F, struct mxcfb_csc_matrix)
 
-int UpdateColorMatrix()
+/***********************************************************************************************************
+ Color correction, in two steps so that the system parameters can be read while the console is restored:
+ ColorMatrix_prepare() reads them and computes the matrix (returns 1 if there is one to apply, 0 if not),
+ ColorMatrix_apply() then loads it in the display controller.
+ ***********************************************************************************************************/
+static struct mxcfb_csc_matrix csc_matrix;
+static bool                    csc_pending = FALSE;
+
+int ColorMatrix_prepare()
 {
   int hue = 0;
   int white = 0;
@@ -460,6 +610,8 @@ int UpdateColorMatrix()
       applyMatrix = TRUE;
   }
 
+  csc_pending = FALSE;
+
   if (!applyMatrix)
     return 0;
 
@@ -560,12 +712,6 @@ int UpdateColorMatrix()
   color_correction_matrix[4][1] = 1.;
   color_correction_matrix[4][2] = 1.;
 
-  int fd;
-  fd = open("/dev/fb1",O_RDWR);
-  if ( fd < 0 )
-    return -1;
-
-  struct mxcfb_csc_matrix csc_matrix;
   memset(&csc_matrix,0,sizeof(csc_matrix));
 
   for(i = 0;i < 3;i++)
@@ -581,6 +727,20 @@ int UpdateColorMatrix()
     csc_matrix.param[4][i] = (int)color_correction_matrix[4][i];
   }
 
+  csc_pending = TRUE;
+  return 1;
+}
+
+int ColorMatrix_apply()
+{
+  if (!csc_pending)
+    return 0;
+
+  int fd;
+  fd = open("/dev/fb1",O_RDWR);
+  if ( fd < 0 )
+    return -1;
+
   int retval = ioctl(fd, MXCFB_CSC_UPDATE_LCD, &csc_matrix);
   close(fd);
   if (retval < 0) {
@@ -588,21 +748,36 @@ int UpdateColorMatrix()
     return -1;
   }
 
+  csc_pending = FALSE;
   return 0;
 }
 
+int UpdateColorMatrix()
+{
+  if (ColorMatrix_prepare() <= 0)
+    return 0;
+
+  return ColorMatrix_apply();
+}
+
 /***********************************************************************************************************
- Updating the backlight brightness value with the one stored in I2C SEEPROM
+ Reading the backlight brightness value stored in I2C SEEPROM
  NOTE: Scaling is done to properly map the range [0..255] of the I2C SEEPROM stored value with the range
        [1..max_brightness], which is the available dynamic range for the backlight driver.
+       Nothing is written to the backlight here, so this can run while the splash is still being drawn.
  ***********************************************************************************************************/
-void UpdateBrightness()
+static char brightnessdevice[MAXPATHLENGTH];
+static int  target_brightness = -1;
+
+int ReadBrightness()
 {
   int max_brightness;
-  int target_brightness;
+  int target;
 
   char strval[5]={0,0,0,0,0};
-  char brightnessdevice[MAXPATHLENGTH];
+
+  if (target_brightness > 0)
+    return 0;
 
   // Get the full path for accessing the backlight driver: we should have an additonal subdir to be appended to the hardcoded path
   DIR           *d;
@@ -624,120 +799,355 @@ void UpdateBrightness()
   // Read the max_brightness value for the backlight driver and perform sanity check
   sysfs_read(brightnessdevice,"max_brightness",strval,3);
   if (atoi_s(strval, &max_brightness))
-    return;
+    return -1;
 
   if((max_brightness < 1) || (max_brightness > 255))
     max_brightness = 100;
 
   // Read the target brightness from SEEPROM and perform scaling to suit the dynamic range of the backlight driver
-  target_brightness = get_brightness_from_seeprom();
+  target = get_brightness_from_seeprom();
 
   if ( IS_US03(gethwcode()) ) {
-    if (target_brightness < MAX_GAMMA_LEVEL) {
+    if (target < MAX_GAMMA_LEVEL) {
       // apply gamma correction
-      applyGammaDimming(target_brightness);
-      target_brightness = 1;
+      applyGammaDimming(target);
+      target = 1;
     } else {
       applyGammaDimming(MAX_GAMMA_LEVEL);
-      target_brightness -= MAX_GAMMA_LEVEL;
-      target_brightness = ceil((target_brightness * max_brightness)/(255.0 - MAX_GAMMA_LEVEL));
+      target -= MAX_GAMMA_LEVEL;
+      target = ceil((target * max_brightness)/(255.0 - MAX_GAMMA_LEVEL));
     }
   } else {
-    target_brightness = ceil((target_brightness * max_brightness)/(255.0));
+    target = ceil((target * max_brightness)/(255.0));
   }
 
-  if(target_brightness > max_brightness)
-    target_brightness = max_brightness;
+  if(target > max_brightness)
+    target = max_brightness;
 
-  if(target_brightness < 1)
-    target_brightness = 1;
+  if(target < 1)
+    target = 1;
 
-  // Transition loop to set the actual brightness value
-  int usdelay = 1000000 / target_brightness;
-  int i;
+  target_brightness = target;
+  return 0;
+}
+
+/***********************************************************************************************************
+ Fading the backlight brightness in, up to the value stored in I2C SEEPROM
+ NOTE: The fade is not blocking: Brightness_fade_start() only opens the brightness file, which is then kept
+       open, and the main loop calls Brightness_fade_step() each time the returned delay expires.
+       int duration_ms (fade duration, 0 sets the target value at once)
+       int curve       (FADE_LINEAR, FADE_QUADRATIC or FADE_SMOOTH)
+ ***********************************************************************************************************/
+#define FADE_MIN_INTERVAL_MS 10
+
+static int             fade_fd = -1;
+static int             fade_curve;
+static int             fade_duration_ms;
+static int             fade_interval_ms;
+static int             fade_current;
+static struct timespec fade_start;
 
-  for(i=1; i < target_brightness; i++)
+//Sets the brightness value as desired (without saving to i2c SEEPROM)
+static int SetBrightness(int val)
+{
+  char strval[16];
+  int  len;
+
+  if (val == fade_current)
+    return 0;
+
+  len = snprintf(strval, sizeof(strval), "%d", val);
+  if (pwrite(fade_fd, strval, len, 0) != len)
   {
-    SetBrightness(brightnessdevice, & i);
-    usleep(usdelay);
+    fprintf(stderr, "psplash: Error setting brightness: err=%s\n", strerror(errno));
+    return -1;
   }
 
-  SetBrightness(brightnessdevice, &target_brightness);
+  fade_current = val;
+  return 0;
 }
 
-/***********************************************************************************************************
- Opening the touchscreen event for reading.
- ret = int touch_fd = file descriptor (< 0 if error)
- NOTE: The touch event can be defined by the "TSDEVICE" environment var. If TSDEVICE not defined, the
-       default "/dev/input/event0" or  "/dev/input/event1" is used, based on the hw_code (taken from cmdline)
-       hw_code=110 -> "/dev/input/event0" (This is the ECO panel, which uses the CPU touch controller)
-       hw_code=124,125,122,121 -> "/dev/input/event2" (jSmart, Wu16+uS03, Wu16+uS01)
-       hw_code=... -> "/dev/input/event1"
- ***********************************************************************************************************/
-int Touch_open()
+int Brightness_fade_start(int duration_ms, int curve)
 {
-  int touch_fd = -1;
-  char *tsdevice = NULL;
+  char path[MAXPATHLENGTH + 16];
 
-  if( (tsdevice = getenv("TSDEVICE")) != NULL )
+  if (ReadBrightness())
+    return -1;
+
+  snprintf(path, sizeof(path), "%sbrightness", brightnessdevice);
+  if ((fade_fd = open(path, O_WRONLY | O_CLOEXEC)) < 0)
   {
-    touch_fd = open(tsdevice,O_RDONLY | O_NONBLOCK);
+    fprintf(stderr,"Cannot open sysfs file -> %s \n", path);
+    return -1;
   }
-  else
+
+  fade_curve = curve;
+  fade_duration_ms = (duration_ms > 0) ? duration_ms : 0;
+  fade_interval_ms = fade_duration_ms / target_brightness;
+  if (fade_interval_ms < FADE_MIN_INTERVAL_MS)
+    fade_interval_ms = FADE_MIN_INTERVAL_MS;
+  fade_current = -1;
+  clock_gettime(CLOCK_MONOTONIC, &fade_start);
+
+  return 0;
+}
+
+void Brightness_fade_finish()
+{
+  if (fade_fd < 0)
+    return;
+
+  SetBrightness(target_brightness);
+  close(fade_fd);
+  fade_fd = -1;
+}
+
+// Returns the delay [ms] before the next step is due, or -1 if no fade is running
+int Brightness_fade_step()
+{
+  struct timespec now;
+  long            elapsed_ms;
+  double          x;
+
+  if (fade_fd < 0)
+    return -1;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  elapsed_ms = (now.tv_sec - fade_start.tv_sec) * 1000 + (now.tv_nsec - fade_start.tv_nsec) / 1000000;
+
+  if (elapsed_ms >= fade_duration_ms)
   {
-    int hw_code = gethwcode();
-    int touch_type = gettouchtype();
+    Brightness_fade_finish();
+    return -1;
+  }
 
-    switch( hw_code )
-    {
+  x = (double) elapsed_ms / fade_duration_ms;
+  switch (fade_curve)
+  {
+    case FADE_QUADRATIC:
+      x = x * x;
+      break;
+    case FADE_SMOOTH:
+      x = x * x * (3 - 2 * x);
+      break;
+    case FADE_LINEAR:
+    default:
+      break;
+  }
+
+  SetBrightness(1 + (int)(x * (target_brightness - 1)));
+  return fade_interval_ms;
+}
+
+/***********************************************************************************************************
+ Default touchscreen event, based on the hw_code (taken from cmdline)
+ hw_code=110 -> "/dev/input/event0" (This is the ECO panel, which uses the CPU touch controller)
+ hw_code=124,125,122,121 -> "/dev/input/event2" (jSmart, Wu16+uS03, Wu16+uS01)
+ hw_code=... -> "/dev/input/event1"
+ const char** alt (second choice, if any)
+ ***********************************************************************************************************/
+static const char* Touch_default_device(const char** alt)
+{
+  int hw_code = gethwcode();
+  int touch_type = gettouchtype();
+
+  *alt = NULL;
+
+  switch( hw_code )
+  {
 	case ECO_VAL:
 	case BE15A_VAL:
 	case BE15B_VAL:
 	case PGDXCA16_VAL:
 	case AB19_VAL:
-	    touch_fd = open(DEFAULT_TOUCH_EVENT0,O_RDONLY | O_NONBLOCK);
-	    break;
+	    return DEFAULT_TOUCH_EVENT0;
 
 	case PGDXCA18_VAL:
 	case PGDXCA7LE_VAL:
 	    /* CA18 could be have 2 types of Touchscreen analog (touch_type=10) or i2c */
             if ( touch_type == 10 )
-	        touch_fd = open(DEFAULT_TOUCH_EVENT2,O_RDONLY | O_NONBLOCK);
+	        return DEFAULT_TOUCH_EVENT2;
 	    else
-		touch_fd = open(DEFAULT_TOUCH_EVENT0,O_RDONLY | O_NONBLOCK);
-	    break;
+		return DEFAULT_TOUCH_EVENT0;
 
 	case WU16_VAL:
 	case US03WU16_VAL:
 	case EX8XX_VAL:
 	case NS02WU20_VAL:
 	case JS8XX_VAL:
-	    touch_fd = open(DEFAULT_TOUCH_EVENT2,O_RDONLY | O_NONBLOCK);
-	    break;
+	    return DEFAULT_TOUCH_EVENT2;
 
 	case AUTEC_VAL:
-	    touch_fd = open(DEFAULT_TOUCH_EVENT1,O_RDONLY | O_NONBLOCK);
-	    if( touch_fd < 0 ){
-			touch_fd = open(DEFAULT_TOUCH_EVENT0,O_RDONLY | O_NONBLOCK);
-	    }
-	    break;
+	    *alt = DEFAULT_TOUCH_EVENT0;
+	    return DEFAULT_TOUCH_EVENT1;
 
 	case US04WU10_VAL:
-	    touch_fd = open(DEFAULT_TOUCH_EVENT3,O_RDONLY | O_NONBLOCK);
-	    break;
+	    return DEFAULT_TOUCH_EVENT3;
 
 	default:
-	    touch_fd = open(DEFAULT_TOUCH_EVENT1,O_RDONLY | O_NONBLOCK);
-	    break;
-    }
+	    return DEFAULT_TOUCH_EVENT1;
   }
+}
 
-  if(touch_fd < 0)
-    fprintf(stderr, "psplash: Error opening the touch event: err=%s\n", strerror(errno));
+#define BITS_PER_LONG          (sizeof(long) * 8)
+#define NBITS(x)               ((((x) - 1) / BITS_PER_LONG) + 1)
+#define TEST_BIT(bit, array)   ((array[(bit) / BITS_PER_LONG] >> ((bit) % BITS_PER_LONG)) & 1)
+
+/* Opens the given event device, only if it reports touch capabilities (BTN_LEFT accepted when allow_left) */
+static int Touch_open_device(const char* path, int allow_left)
+{
+  unsigned long keybits[NBITS(KEY_MAX)];
+  unsigned long absbits[NBITS(ABS_MAX)];
+  int touch_fd;
+
+  if ((touch_fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC)) < 0)
+    return -1;
+
+  memset(keybits, 0, sizeof(keybits));
+  memset(absbits, 0, sizeof(absbits));
+  ioctl(touch_fd, EVIOCGBIT(EV_KEY, sizeof(keybits)), keybits);
+  ioctl(touch_fd, EVIOCGBIT(EV_ABS, sizeof(absbits)), absbits);
+
+  if (TEST_BIT(BTN_TOUCH, keybits) || TEST_BIT(ABS_MT_POSITION_X, absbits) ||
+      (allow_left && TEST_BIT(BTN_LEFT, keybits)))
+    return touch_fd;
+
+  close(touch_fd);
+  return -1;
+}
+
+/* Looks for the first (lowest numbered) touchscreen among all the input event devices */
+static int Touch_scan()
+{
+  DIR           *d;
+  struct dirent *dir;
+  char           path[MAXPATHLENGTH];
+  int            best = INT_MAX;
+  int            n, fd;
+
+  if ((d = opendir(INPUTDEVICEDIR)) == NULL)
+    return -1;
+
+  while ((dir = readdir(d)) != NULL)
+  {
+    if (sscanf(dir->d_name, "event%d", &n) != 1 || n >= best)
+      continue;
+
+    snprintf(path, sizeof(path), "%s/%s", INPUTDEVICEDIR, dir->d_name);
+    if ((fd = Touch_open_device(path, 0)) < 0)
+      continue;
+
+    close(fd);
+    best = n;
+  }
+  closedir(d);
+
+  if (best == INT_MAX)
+    return -1;
+
+  snprintf(path, sizeof(path), "%s/event%d", INPUTDEVICEDIR, best);
+  return Touch_open_device(path, 0);
+}
+
+/***********************************************************************************************************
+ Opening the touchscreen event for reading.
+ ret = int touch_fd = file descriptor (< 0 if error)
+ NOTE: The touch event can be defined by the "TSDEVICE" environment var. If TSDEVICE not defined, the
+       default event for the hw_code is used (see Touch_default_device), as long as it is a touchscreen;
+       otherwise the first input device reporting touch capabilities is taken.
+       Failures are reported only once, since this is called again each time a new input device shows up
+       (see Touch_watch_open).
+ ***********************************************************************************************************/
+int Touch_open()
+{
+  static int reported = 0;
+  int touch_fd = -1;
+  char *tsdevice = NULL;
+
+  if( (tsdevice = getenv("TSDEVICE")) != NULL )
+  {
+    touch_fd = open(tsdevice,O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+  }
+  else
+  {
+    const char* alt;
+    const char* device = Touch_default_device(&alt);
+
+    touch_fd = Touch_open_device(device, 1);
+    if (touch_fd < 0 && alt != NULL)
+      touch_fd = Touch_open_device(alt, 1);
+    if (touch_fd < 0)
+      touch_fd = Touch_scan();
+  }
+
+  if(touch_fd < 0 && !reported)
+  {
+    fprintf(stderr, "psplash: touchscreen not available yet, waiting for it\n");
+    reported = 1;
+  }
 
   return touch_fd;
 }
 
+/***********************************************************************************************************
+ Watching for input devices being added, so that a late touchscreen can be opened without polling.
+ ret = int watch_fd = inotify file descriptor (< 0 if error), to be passed to Touch_watch_handler when readable
+ NOTE: If /dev/input doesn't exist yet, /dev is watched until it shows up.
+ ***********************************************************************************************************/
+int Touch_watch_open()
+{
+  int watch_fd;
+
+  if ((watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0)
+  {
+    fprintf(stderr, "psplash: Error watching input devices: err=%s\n", strerror(errno));
+    return -1;
+  }
+
+  if (inotify_add_watch(watch_fd, INPUTDEVICEDIR, IN_CREATE | IN_ATTRIB) < 0 &&
+      inotify_add_watch(watch_fd, "/dev", IN_CREATE | IN_ONLYDIR) < 0)
+  {
+    fprintf(stderr, "psplash: Error watching input devices: err=%s\n", strerror(errno));
+    close(watch_fd);
+    return -1;
+  }
+
+  return watch_fd;
+}
+
+/***********************************************************************************************************
+ Handles the pending inotify events.
+ ret = 1 if a new input event device (may) have appeared, so that Touch_open() is worth retrying
+ ***********************************************************************************************************/
+int Touch_watch_handler(int watch_fd)
+{
+  char buf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  const struct inotify_event *ev;
+  int ret = 0;
+  ssize_t len;
+  char *p;
+
+  while ((len = read(watch_fd, buf, sizeof(buf))) > 0)
+  {
+    for (p = buf; p < buf + len; p += sizeof(struct inotify_event) + ev->len)
+    {
+      ev = (const struct inotify_event *) p;
+      if (ev->len == 0)
+        continue;
+
+      if (!strncmp(ev->name, "event", 5))
+        ret = 1;
+      else if ((ev->mask & IN_ISDIR) && !strcmp(ev->name, "input"))
+      {
+        // /dev/input just created: from now on, watch that one
+        if (inotify_add_watch(watch_fd, INPUTDEVICEDIR, IN_CREATE | IN_ATTRIB) >= 0)
+          ret = 1;
+      }
+    }
+  }
+
+  return ret;
+}
 
 /***********************************************************************************************************
  Closing the touchscreen file descriptor.
@@ -752,57 +1162,55 @@ void Touch_close(int touch_fd)
 
 /***********************************************************************************************************
  Touch handler: counts the number of tap-tap events detected and gets the last detected touch status.
- int  touch_fd   (file descriptor to touchscreen event)
+ int  touch_fd   (file descriptor to touchscreen event, opened in non blocking mode)
  int* taptap     (taptap detected number)
  int* laststatus (0=up, 1=pressed)
  int ret = number of detected UP/DOWN events (0=nothing happened)
+ NOTE: Events are read in batches until the queue is empty; a touch controller streams lots of ABS events
+       per tap, which are all skipped.
  ***********************************************************************************************************/
+#define TOUCH_BATCH 64
+
 int Touch_handler(int touch_fd, int* taptap, int* laststatus)
 {
-  struct input_event ev;
-  fd_set fdset;
-  struct timeval tv;
+  struct input_event ev[TOUCH_BATCH];
   int count = 0;
-  int nfds;
   int ret;
+  int i, n;
 
   if(touch_fd < 0)
     return 0;
 
-  while (1)
+  do
   {
-    FD_ZERO(&fdset);
-    FD_SET(touch_fd, &fdset);
-
-    tv.tv_sec = 0;
-    tv.tv_usec = 0;
-
-    nfds = select(touch_fd + 1, &fdset, NULL, NULL, &tv);
-    if (nfds == 0)
+    ret = read(touch_fd, ev, sizeof(ev));
+    if (ret < (int)sizeof(struct input_event))
       break;
 
-    ret = read(touch_fd, &ev, sizeof(struct input_event));
-    if (ret < (int)sizeof(struct input_event))
+    n = ret / sizeof(struct input_event);
+
+    for (i = 0; i < n; i++)
     {
-      break;
-    }
+      if (ev[i].type != EV_KEY)
+        continue;
 
-    if (ev.type == EV_KEY)
-      if((ev.code == BTN_TOUCH) || (ev.code == BTN_LEFT))
+      if((ev[i].code == BTN_TOUCH) || (ev[i].code == BTN_LEFT))
       {
-	if(ev.value == 0)
+	if(ev[i].value == 0)
 	{ //pen UP
 	  *taptap = *taptap + 1;
 	  *laststatus = 0;
 	  count++;
 	}
-	else if(ev.value == 1)
+	else if(ev[i].value == 1)
 	{ //pen DW
 	  *laststatus = 1;
 	  count++;
 	}
       }
+    }
   }
+  while (n == TOUCH_BATCH);
 
   return count;
 }
@@ -25,16 +25,29 @@
 #define TAPTAP_TH   3
 #define USESMALLFONT_TH 500
 
+#define FADE_LINEAR     0
+#define FADE_QUADRATIC  1
+#define FADE_SMOOTH     2
+
 void Read_HWCode();
-int psplash_draw_custom_splashimage(PSplashFB *fb);
-void UpdateBrightness();
+int psplash_load_custom_splashimage();
+int psplash_draw_custom_splashimage(PSplashFB *fb, int buffered);
+int ReadBrightness();
+int Brightness_fade_start(int duration_ms, int curve);
+int Brightness_fade_step();
+void Brightness_fade_finish();
 int Touch_handler(int touch_fd, int* taptap, int* laststatus);
 void Touch_close(int touch_fd);
 int Touch_open();
+int Touch_watch_open();
+int Touch_watch_handler(int watch_fd);
 void TapTap_Progress(PSplashFB *fb, int taptap);
 int TapTap_Detected(int touch_fd, PSplashFB *fb, int laststatus);
 int FastBootTapTap_Detected(int touch_fd, PSplashFB *fb, int laststatus);
 int setbootcounter(unsigned char val);
+int ColorMatrix_prepare();
+int ColorMatrix_apply();
 int UpdateColorMatrix();
+void Spawn_set_sigmask(const sigset_t* mask);
 
 #endif
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# Generates a psplash font header (e.g. radeon-font.h) from a BDF font.
+#
+#   make-font-header.py <font.bdf> <name> [<short name>] > <name>-font.h
+#
+# The header exports <name>_font, its tables are prefixed with _<short name>.
+#
+# Glyph rows are stored MSB first in 1, 2 or 4 bytes each, whichever
+# fits the glyph width, and looked up through the BOGL style index.
+#
+
+import sys
+
+INDEX_BITS = 8
+MASK = (1 << INDEX_BITS) - 1
+
+
+def parse_bdf(path):
+    ascent = descent = None
+    bbox = None
+    glyphs = {}
+    glyph = None
+    bitmap = None
+
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+
+            if bitmap is not None:
+                if key == "ENDCHAR":
+                    glyph["bitmap"] = bitmap
+                    if glyph["code"] >= 0:
+                        glyphs[glyph["code"]] = glyph
+                    glyph = bitmap = None
+                else:
+                    bitmap.append(int(key, 16))
+            elif key == "FONTBOUNDINGBOX":
+                bbox = [int(w) for w in words[1:5]]
+            elif key == "FONT_ASCENT":
+                ascent = int(words[1])
+            elif key == "FONT_DESCENT":
+                descent = int(words[1])
+            elif key == "STARTCHAR":
+                glyph = {"name": " ".join(words[1:]), "code": -1, "dwidth": None}
+            elif key == "ENCODING":
+                glyph["code"] = int(words[1])
+            elif key == "DWIDTH":
+                glyph["dwidth"] = int(words[1])
+            elif key == "BBX":
+                glyph["bbx"] = [int(w) for w in words[1:5]]
+            elif key == "BITMAP":
+                bitmap = []
+
+    if ascent is None:
+        ascent = bbox[1] + bbox[3]
+    if descent is None:
+        descent = -bbox[3]
+
+    return ascent, descent, glyphs
+
+
+def render(glyph, ascent, height):
+    """Returns the glyph width and its rows, left-aligned in 32 bits"""
+    w, h, xoff, yoff = glyph["bbx"]
+    width = glyph["dwidth"] if glyph["dwidth"] is not None else w
+    width = min(width, 32)
+    rows = [0] * height
+    rowbits = ((w + 7) // 8) * 8
+    top = ascent - (yoff + h)
+
+    for i, bits in enumerate(glyph["bitmap"]):
+        y = top + i
+        if 0 <= y < height:
+            # left-align in 32 bits, then move to the bbx origin
+            if rowbits > 32:
+                bits >>= rowbits - 32
+            else:
+                bits <<= 32 - rowbits
+            bits = (bits >> xoff) if xoff >= 0 else (bits << -xoff)
+            # clip to the advance width
+            rows[y] = bits & ((0xffffffff << (32 - width)) & 0xffffffff)
+
+    return width, rows
+
+
+def row_bytes(width):
+    return 1 if width <= 8 else 2 if width <= 16 else 4
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.exit("Usage: %s <font.bdf> <name> [<short name>]" % sys.argv[0])
+
+    path, name = sys.argv[1], sys.argv[2]
+    short = sys.argv[3] if len(sys.argv) == 4 else name
+    ascent, descent, glyphs = parse_bdf(path)
+    height = ascent + descent
+    out = sys.stdout
+
+    out.write('#include "psplash.h"\n\n')
+    out.write("/* Font generated from '%s' bdf font by make-font-header.py */\n\n" % name)
+
+    # Content: every glyph, rows of 1, 2 or 4 bytes
+    content = []
+    where = {}
+    pos = 0
+    for code in sorted(glyphs):
+        width, rows = render(glyphs[code], ascent, height)
+        where[code] = (width, pos)
+        content.append((code, width, rows, pos))
+        pos += row_bytes(width) * height
+
+    # Index: for each bucket, (code & ~MASK | width, content offset) pairs and a 0
+    index = []
+    offset = [None] * (MASK + 1)
+    size = 0
+    for bucket in range(MASK + 1):
+        codes = [c for c in sorted(glyphs) if (c & MASK) == bucket]
+        if not codes:
+            continue
+        offset[bucket] = size
+        for c in codes:
+            index.append(c)
+            size += 2
+        index.append(None)
+        size += 1
+    empty = size
+    index.append(None)
+    size += 1
+
+    out.write("/* Offsets into index. */\n")
+    out.write("static int _%s_offset[%d] = {\n" % (short, MASK + 1))
+    for bucket in range(MASK + 1):
+        value = offset[bucket] if offset[bucket] is not None else empty
+        out.write("  %d, /* (0x%x) */\n" % (value, bucket))
+    out.write("};\n\n")
+
+    out.write("/* Index into content data. */\n")
+    out.write("static int _%s_index[%d] = {\n" % (short, size))
+    for c in index:
+        if c is None:
+            out.write("  0,\n")
+        else:
+            width, pos = where[c]
+            out.write("  0x%x, %d,\n" % ((c & ~MASK) | width, pos))
+    out.write("};\n\n")
+
+    out.write("/* Font character content data. */\n")
+    out.write("static uint8 _%s_content[] = {\n" % short)
+    for code, width, rows, pos in content:
+        nbytes = row_bytes(width)
+        out.write("\n/* %d: character %s (0x%x), width %d, %d byte(s) per row */\n"
+                  % (pos, chr(code) if 0x20 <= code < 0x7f else " ",
+                     code, width, nbytes))
+        out.write("/* +%s+\n" % ("-" * width))
+        for bits in rows:
+            out.write("   |%s|\n" % "".join("*" if bits & (0x80000000 >> x) else " "
+                                           for x in range(width)))
+        out.write("   +%s+ */\n" % ("-" * width))
+        for bits in rows:
+            out.write(", ".join("0x%02x" % ((bits >> (24 - 8 * i)) & 0xff)
+                                for i in range(nbytes)) + ",\n")
+    out.write("\n};\n\n")
+
+    out.write("/* Exported structure definition. */\n")
+    out.write("const PSplashFont %s_font = {\n" % name)
+    out.write('  "%s",\n' % short)
+    out.write("  %d,\n" % height)
+    out.write("  0x%x,\n" % MASK)
+    out.write("  _%s_offset,\n" % short)
+    out.write("  _%s_index,\n" % short)
+    out.write("  _%s_content,\n" % short)
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
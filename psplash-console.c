@@ -21,8 +21,9 @@
 static int ConsoleFd      = -1;
 static int VTNum          = -1;
 static int VTNumInitial   = -1;
-static int Visible        =  1;
-static int VTRequested    =  FALSE;
+static volatile sig_atomic_t Visible     = 1;
+static volatile sig_atomic_t VTRequested = FALSE;
+static volatile sig_atomic_t VTAcquired  = FALSE;
 
 static void
 vt_request (int sig)
@@ -36,13 +37,9 @@ vt_request (int sig)
 	perror("Error cannot switch away from console");
       Visible = 0;
 
-      /* FIXME: 
-       * We likely now want to signal the main loop as to exit	 
-       * and we've now likely switched to the X tty. Note, this
-       * seems to happen anyway atm due to select() call getting
-       * a signal interuption error - not sure if this is really
-       * reliable however. 
-      */
+      /* We've now likely switched to the X tty: the main loop checks
+       * vt_requested() and exits, unless told to keep running, drawing
+       * only to the back buffer until the VT comes back (vt_visible()) */
 
       VTRequested = TRUE;
     }
@@ -51,16 +48,35 @@ vt_request (int sig)
       if (ioctl (ConsoleFd, VT_RELDISP, VT_ACKACQ))
 	perror ("Error can't acknowledge VT switch");
       Visible = 1;
-      /* FIXME: need to schedule repaint some how ? */
+
+      /* The main loop checks vt_acquired() and repaints from the back buffer */
+      VTAcquired = TRUE;
     }
 }
 
 bool
-vt_requested ()
+vt_requested (void)
 {
   return VTRequested;
 }
 
+bool
+vt_visible (void)
+{
+  return Visible;
+}
+
+/* TRUE once after getting the VT back, whatever was shown meanwhile is
+ * still on screen */
+bool
+vt_acquired (void)
+{
+  bool acquired = VTAcquired;
+
+  VTAcquired = FALSE;
+  return acquired;
+}
+
 static void
 psplash_console_ignore_switches (void)
 {
@@ -27,4 +27,10 @@ psplash_console_reset (void);
 bool
 vt_requested (void);
 
+bool
+vt_visible (void);
+
+bool
+vt_acquired (void);
+
 #endif
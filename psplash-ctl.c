@@ -0,0 +1,252 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Control socket, with a reply to every command.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-ctl.h"
+#include <time.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static void
+ctl_watch (PSplashCtl *ctl, int fd, int op, uint32_t events)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof(ev));
+  ev.events  = events;
+  ev.data.fd = fd;
+
+  if (epoll_ctl (ctl->epoll_fd, op, fd, &ev))
+    perror ("epoll_ctl");
+}
+
+static void
+ctl_send (PSplashCtlClient *client, const char *err)
+{
+  char            reply[PSPLASH_CTL_MSG_LEN];
+  struct timespec now;
+  int             len;
+
+  if (err)
+    len = snprintf (reply, sizeof(reply), "ERR %s", err);
+  else
+    {
+      clock_gettime (CLOCK_MONOTONIC, &now);
+      len = snprintf (reply, sizeof(reply), "OK %ld.%06ld",
+                      (long) now.tv_sec, now.tv_nsec / 1000);
+    }
+
+  /* A client not waiting for replies just loses them */
+  send (client->fd, reply, len + 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+void
+psplash_ctl_drop (PSplashCtl *ctl, PSplashCtlClient *client)
+{
+  if (client->deferred)
+    ctl->ndeferred--;
+
+  epoll_ctl (ctl->epoll_fd, EPOLL_CTL_DEL, client->fd, NULL);
+  close (client->fd);
+  client->fd       = -1;
+  client->deferred = 0;
+  client->error    = NULL;
+}
+
+int
+psplash_ctl_listen (void)
+{
+  struct sockaddr_un addr;
+  int                fd;
+
+  if ((fd = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0)
+    {
+      perror ("socket");
+      return -1;
+    }
+
+  memset (&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy (addr.sun_path, PSPLASH_SOCKET, sizeof(addr.sun_path) - 1);
+
+  /* Left over by a previous instance */
+  unlink (PSPLASH_SOCKET);
+
+  if (bind (fd, (struct sockaddr *) &addr, sizeof(addr))
+      || listen (fd, PSPLASH_CTL_MAX_CLIENTS))
+    {
+      perror ("socket bind");
+      close (fd);
+      return -1;
+    }
+
+  return fd;
+}
+
+void
+psplash_ctl_init (PSplashCtl *ctl, int epoll_fd, int listen_fd)
+{
+  int i;
+
+  ctl->epoll_fd  = epoll_fd;
+  ctl->listen_fd = listen_fd;
+  ctl->ndeferred = 0;
+
+  for (i = 0; i < PSPLASH_CTL_MAX_CLIENTS; i++)
+    {
+      ctl->client[i].fd       = -1;
+      ctl->client[i].deferred = 0;
+      ctl->client[i].error    = NULL;
+    }
+
+  if (listen_fd >= 0)
+    ctl_watch (ctl, listen_fd, EPOLL_CTL_ADD, EPOLLIN);
+}
+
+void
+psplash_ctl_close (PSplashCtl *ctl)
+{
+  int i;
+
+  for (i = 0; i < PSPLASH_CTL_MAX_CLIENTS; i++)
+    if (ctl->client[i].fd >= 0)
+      psplash_ctl_drop (ctl, &ctl->client[i]);
+}
+
+void
+psplash_ctl_accept (PSplashCtl *ctl)
+{
+  int fd, i;
+
+  while ((fd = accept4 (ctl->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+    {
+      for (i = 0; i < PSPLASH_CTL_MAX_CLIENTS; i++)
+        if (ctl->client[i].fd < 0)
+          break;
+
+      if (i == PSPLASH_CTL_MAX_CLIENTS)
+        {
+          fprintf (stderr, "psplash: too many control clients\n");
+          close (fd);
+          continue;
+        }
+
+      ctl->client[i].fd = fd;
+      ctl_watch (ctl, fd, EPOLL_CTL_ADD, EPOLLIN);
+    }
+}
+
+PSplashCtlClient *
+psplash_ctl_client (PSplashCtl *ctl, int fd)
+{
+  int i;
+
+  for (i = 0; i < PSPLASH_CTL_MAX_CLIENTS; i++)
+    if (ctl->client[i].fd == fd)
+      return &ctl->client[i];
+
+  return NULL;
+}
+
+int
+psplash_ctl_recv (PSplashCtl *ctl, PSplashCtlClient *client, char *buf, size_t size)
+{
+  struct iovec  iov;
+  struct msghdr msg;
+  ssize_t       n;
+
+  iov.iov_base = buf;
+  iov.iov_len  = size - 1;
+  memset (&msg, 0, sizeof(msg));
+  msg.msg_iov    = &iov;
+  msg.msg_iovlen = 1;
+
+  n = recvmsg (client->fd, &msg, MSG_DONTWAIT);
+
+  if (n < 0 && (errno == EAGAIN || errno == EINTR))
+    return 0;
+
+  if (n <= 0)
+    {
+      psplash_ctl_drop (ctl, client);
+      return -1;
+    }
+
+  if (msg.msg_flags & MSG_TRUNC)
+    {
+      psplash_ctl_reply (ctl, client, "command too long");
+      return 0;
+    }
+
+  /* The terminating NUL is optional */
+  buf[n] = '\0';
+  return strlen (buf);
+}
+
+void
+psplash_ctl_reply (PSplashCtl *ctl, PSplashCtlClient *client, const char *err)
+{
+  if (client->deferred == 0)
+    {
+      ctl_send (client, err);
+      return;
+    }
+
+  if (err == NULL)
+    {
+      client->deferred++;
+      return;
+    }
+
+  /* Has to wait for the replies before it, and so do further commands */
+  client->error = err;
+  ctl_watch (ctl, client->fd, EPOLL_CTL_MOD, 0);
+}
+
+void
+psplash_ctl_defer (PSplashCtl *ctl, PSplashCtlClient *client)
+{
+  if (client->deferred++ == 0)
+    ctl->ndeferred++;
+}
+
+void
+psplash_ctl_frame_done (PSplashCtl *ctl)
+{
+  int i;
+
+  for (i = 0; ctl->ndeferred > 0 && i < PSPLASH_CTL_MAX_CLIENTS; i++)
+    {
+      PSplashCtlClient *client = &ctl->client[i];
+
+      if (client->fd < 0 || client->deferred == 0)
+        continue;
+
+      for (; client->deferred > 0; client->deferred--)
+        ctl_send (client, NULL);
+
+      if (client->error)
+        {
+          ctl_send (client, client->error);
+          client->error = NULL;
+          ctl_watch (ctl, client->fd, EPOLL_CTL_MOD, EPOLLIN);
+        }
+
+      ctl->ndeferred--;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Control socket: same commands as the FIFO, one per SOCK_SEQPACKET
+ *  message, each one answered in order with "OK <time>" once drawn, or
+ *  "ERR <why>". <time> is the CLOCK_MONOTONIC time, in seconds, the frame
+ *  showing the command was done at.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_CTL_H
+#define _HAVE_PSPLASH_CTL_H
+
+#define PSPLASH_CTL_MAX_CLIENTS  8
+#define PSPLASH_CTL_MSG_LEN      256
+
+typedef struct PSplashCtlClient
+{
+  int          fd;
+  int          deferred;    /* "OK" replies held back until the next frame */
+  const char  *error;       /* then this one, not reading commands meanwhile */
+}
+PSplashCtlClient;
+
+typedef struct PSplashCtl
+{
+  int               epoll_fd;
+  int               listen_fd;
+  int               ndeferred;       /* clients with deferred replies */
+  PSplashCtlClient  client[PSPLASH_CTL_MAX_CLIENTS];
+}
+PSplashCtl;
+
+/* Creates and binds PSPLASH_SOCKET in the current directory, early enough
+ * for clients to queue up while starting. Returns the listening fd. */
+int
+psplash_ctl_listen (void);
+
+void
+psplash_ctl_init (PSplashCtl *ctl, int epoll_fd, int listen_fd);
+
+/* Drops all the clients, the listening fd is left to the caller */
+void
+psplash_ctl_close (PSplashCtl *ctl);
+
+void
+psplash_ctl_accept (PSplashCtl *ctl);
+
+/* The client owning fd, NULL if fd isn't a control connection */
+PSplashCtlClient *
+psplash_ctl_client (PSplashCtl *ctl, int fd);
+
+/* Receives the next command of client as a NUL terminated string.
+ * Returns its length, 0 if none is queued, -1 if the client is gone
+ * (and has been dropped) */
+int
+psplash_ctl_recv (PSplashCtl *ctl, PSplashCtlClient *client, char *buf, size_t size);
+
+void
+psplash_ctl_drop (PSplashCtl *ctl, PSplashCtlClient *client);
+
+/* Replies "OK <time>" (err == NULL) or "ERR <err>", after the deferred
+ * replies if there are any */
+void
+psplash_ctl_reply (PSplashCtl *ctl, PSplashCtlClient *client, const char *err);
+
+/* Replies "OK <time>" once the next frame is out */
+void
+psplash_ctl_defer (PSplashCtl *ctl, PSplashCtlClient *client);
+
+/* Sends the deferred replies, once a frame has been flushed */
+void
+psplash_ctl_frame_done (PSplashCtl *ctl);
+
+#endif
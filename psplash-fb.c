@@ -15,6 +15,8 @@
  *
  */
 #include "psplash.h"
+#include "psplash-pool.h"
+#include "psplash-font.h"
 
 //Global variable indicating the font scale factor: 0=>1x 1=>2x 2=>4x
 extern int FONT_SCALE;
@@ -22,6 +24,9 @@ extern int FONT_SCALE;
 void
 psplash_fb_destroy (PSplashFB *fb)
 {
+  if (fb->base != NULL && fb->base != MAP_FAILED)
+    munmap (fb->base, fb->base_size);
+
   if (fb->fd >= 0)
     close (fb->fd);
 
@@ -200,9 +205,10 @@ psplash_fb_new (int angle)
   DBG("width: %i, height: %i, bpp: %i, stride: %i",
       fb->width, fb->height, fb->bpp, fb->stride);
 
+  fb->base_size = fb->stride * fb->height;
   fb->base = (char *) mmap ((caddr_t) NULL,
 			    /*fb_fix.smem_len */
-			    fb->stride * fb->height,
+			    fb->base_size,
 			    PROT_READ|PROT_WRITE,
 			    MAP_SHARED,
 			    fb->fd, 0);
@@ -360,6 +366,27 @@ psplash_fb_plot_pixel (PSplashFB    *fb,
   }
 }
 
+typedef struct PSplashRectJob
+{
+  PSplashFB *fb;
+  int        buffered;
+  int        x, y, width;
+  uint8      red, green, blue;
+}
+PSplashRectJob;
+
+static void
+draw_rect_band (void *data, int y0, int y1)
+{
+  PSplashRectJob *job = data;
+  int             dx, dy;
+
+  for (dy=y0; dy < y1; dy++)
+    for (dx=0; dx < job->width; dx++)
+      psplash_fb_plot_pixel (job->fb, job->buffered, job->x+dx, job->y+dy,
+                             job->red, job->green, job->blue);
+}
+
 void
 psplash_fb_draw_rect (PSplashFB    *fb,
 		      int          buffered,
@@ -371,11 +398,9 @@ psplash_fb_draw_rect (PSplashFB    *fb,
 		      uint8        green,
 		      uint8        blue)
 {
-  int dx, dy;
+  PSplashRectJob job = { fb, buffered, x, y, width, red, green, blue };
 
-  for (dy=0; dy < height; dy++)
-    for (dx=0; dx < width; dx++)
-      psplash_fb_plot_pixel (fb, buffered, x+dx, y+dy, red, green, blue);
+  psplash_pool_run (width, height, draw_rect_band, &job);
 }
 
 void
@@ -433,23 +458,42 @@ psplash_fb_draw_image (PSplashFB    *fb,
 
 /* Font rendering code based on BOGL by Ben Pfaff */
 
+/* Looks up wc, falling back to '?'. Returns the glyph width, 0 if none */
 static int
-psplash_font_glyph (const PSplashFont *font, wchar_t wc, u_int32_t **bitmap)
+psplash_font_glyph (const PSplashFont *font, wchar_t wc, PSplashGlyph *glyph)
 {
   int mask = font->index_mask;
   int i;
 
+  if (font->file != NULL)
+    {
+      PSplashGlyph g;
+
+      psplash_font_file_glyph (font->file, wc, &g);
+      if (glyph != NULL)
+	*glyph = g;
+      return g.width;
+    }
+
   for (;;)
     {
       for (i = font->offset[wc & mask]; font->index[i]; i += 2)
 	{
 	  if ((font->index[i] & ~mask) == (wc & ~mask))
 	    {
-	      if (bitmap != NULL)
-		*bitmap = &font->content[font->index[i+1]];
+	      if (glyph != NULL)
+		{
+		  glyph->rows      = &font->content[font->index[i+1]];
+		  glyph->width     = font->index[i] & mask;
+		  glyph->row_bytes = PSPLASH_GLYPH_ROW_BYTES(glyph->width);
+		}
 	      return font->index[i] & mask;
 	    }
 	}
+
+      if (wc == '?')
+	break;
+      wc = '?';
     }
   return 0;
 }
@@ -490,20 +534,22 @@ psplash_fb_text_size (PSplashFB          *fb,
   *height = (*height) << FONT_SCALE;
 }
 
-void
-psplash_fb_draw_text (PSplashFB         *fb,
-		      int                buffered,
-		      int                x,
-		      int                y,
-		      uint8              red,
-		      uint8              green,
-		      uint8              blue,
-		      const PSplashFont *font,
-		      const char        *text)
+/* Walks text as it is drawn, calling emit for every glyph cell */
+static void
+psplash_fb_text_layout (int                x,
+			int                y,
+			uint8              red,
+			uint8              green,
+			uint8              blue,
+			const PSplashFont *font,
+			const char        *text,
+			void             (*emit) (void *data, const PSplashTextCell *cell),
+			void              *data)
 {
-  int     h, w, k, n, cx, cy, dx, dy;
+  int     h, w, k, n, dx, dy;
   char   *c = (char*)text;
   wchar_t wc;
+  PSplashTextCell cell;
 
   n = strlen (text);
   h = font->height; 
@@ -518,8 +564,6 @@ psplash_fb_draw_text (PSplashFB         *fb,
   mbtowc (0, 0, 0);
   for (; (k = mbtowc (&wc, c, n)) > 0; c += k, n -= k)
     {
-      u_int32_t *glyph = NULL;
-
       if (*c == '\n')
 	{
 	  dy += h;
@@ -538,29 +582,134 @@ psplash_fb_draw_text (PSplashFB         *fb,
 	txtblue = 0x00;
       }
 
-      w = psplash_font_glyph (font, wc, &glyph);
+      w = psplash_font_glyph (font, wc, NULL);
       w = w << FONT_SCALE;
 
-      if (glyph == NULL)
+      if (w == 0)
 	continue;
 
-      for (cy = 0; cy < h; cy++)
-	{
-	  u_int32_t g = *glyph;
-	  
-	  if(((cy+1) >> FONT_SCALE) > (cy >> FONT_SCALE))
-	    glyph++;
+      cell.x      = x + dx;
+      cell.y      = y + dy;
+      cell.width  = w;
+      cell.height = h;
+      cell.wc     = wc;
+      cell.red    = txtred;
+      cell.green  = txtgreen;
+      cell.blue   = txtblue;
+      emit (data, &cell);
 
-	  for (cx = 0; cx < w; cx++)
-	    {
-	      if (g & 0x80000000)
-		psplash_fb_plot_pixel (fb, buffered, x+dx+cx, y+dy+cy, txtred, txtgreen, txtblue);
-	      if(((cx+1) >> FONT_SCALE) > (cx >> FONT_SCALE))
-		g <<= 1;
-	    }
+      dx += w;
+    }
+}
+
+void
+psplash_fb_draw_cell (PSplashFB             *fb,
+		      int                    buffered,
+		      const PSplashFont     *font,
+		      const PSplashTextCell *cell)
+{
+  PSplashGlyph glyph;
+  int          cx, cy;
+
+  psplash_font_glyph (font, cell->wc, &glyph);
+
+  for (cy = 0; cy < cell->height; cy++)
+    {
+      u_int32_t g = psplash_glyph_row (&glyph, cy >> FONT_SCALE);
+
+      for (cx = 0; cx < cell->width; cx++)
+	{
+	  if (g & 0x80000000)
+	    psplash_fb_plot_pixel (fb, buffered, cell->x+cx, cell->y+cy,
+				   cell->red, cell->green, cell->blue);
+	  if(((cx+1) >> FONT_SCALE) > (cx >> FONT_SCALE))
+	    g <<= 1;
 	}
+    }
+}
 
-      dx += w;
+typedef struct PSplashTextJob
+{
+  PSplashFB         *fb;
+  int                buffered;
+  const PSplashFont *font;
+  PSplashTextCell   *cells;
+  int                ncells, max_cells;
+}
+PSplashTextJob;
+
+static void
+text_draw_cell (void *data, const PSplashTextCell *cell)
+{
+  PSplashTextJob *job = data;
+
+  psplash_fb_draw_cell (job->fb, job->buffered, job->font, cell);
+}
+
+static void
+text_store_cell (void *data, const PSplashTextCell *cell)
+{
+  PSplashTextJob *job = data;
+
+  if (job->ncells < job->max_cells)
+    job->cells[job->ncells] = *cell;
+  job->ncells++;
+}
+
+void
+psplash_fb_draw_text (PSplashFB         *fb,
+		      int                buffered,
+		      int                x,
+		      int                y,
+		      uint8              red,
+		      uint8              green,
+		      uint8              blue,
+		      const PSplashFont *font,
+		      const char        *text)
+{
+  PSplashTextJob job = { fb, buffered, font, NULL, 0, 0 };
+
+  psplash_fb_text_layout (x, y, red, green, blue, font, text, text_draw_cell, &job);
+}
+
+int
+psplash_fb_text_cells (PSplashFB         *fb,
+		       int                x,
+		       int                y,
+		       uint8              red,
+		       uint8              green,
+		       uint8              blue,
+		       const PSplashFont *font,
+		       const char        *text,
+		       PSplashTextCell   *cells,
+		       int                max_cells)
+{
+  PSplashTextJob job = { fb, 0, font, cells, 0, max_cells };
+
+  psplash_fb_text_layout (x, y, red, green, blue, font, text, text_store_cell, &job);
+  return job.ncells;
+}
+
+typedef struct PSplashFlushJob
+{
+  PSplashFB *fb;
+  int        x, y, width;
+}
+PSplashFlushJob;
+
+static void
+flush_rect_band (void *data, int y0, int y1)
+{
+  PSplashFlushJob *job = data;
+  PSplashFB       *fb  = job->fb;
+  int              dy, off;
+
+  for (dy=y0; dy < y1; dy++)
+    {
+      off = PSPLASH_OFFSET (fb, job->x, job->y + dy);
+
+      // copy internal buffer to fb
+      memcpy(fb->data + off, fb->data_buf + off, job->width * (fb->bpp >> 3));
     }
 }
 
@@ -571,14 +720,52 @@ psplash_fb_flush_rect (PSplashFB    *fb,
 		       int          width,
 		       int          height)
 {
-  int dx, dy, off;
+  PSplashFlushJob job;
 
-  for (dy=0; dy < height; dy++)
-    for (dx=0; dx < width; dx++)
-      {
-        off = psplash_offset(fb, x+dx, y+dy);
+  /* The screen belongs to another VT, the back buffer is flushed whole
+   * when it comes back */
+  if (fb->hidden)
+    return;
 
-        // copy internal buffer to fb
-        memcpy(fb->data + off, fb->data_buf + off, fb->bpp / 8);
-      }
+  /* Clip to the (rotated) screen */
+  if (x < 0) { width  += x; x = 0; }
+  if (y < 0) { height += y; y = 0; }
+  if (x + width  > fb->width)  width  = fb->width  - x;
+  if (y + height > fb->height) height = fb->height - y;
+
+  if (width <= 0 || height <= 0)
+    return;
+
+  /* A rotated rectangle is still a rectangle, so map it to the real
+   * framebuffer once and copy whole scanlines from there */
+  job.fb = fb;
+
+  switch (fb->angle)
+    {
+    case 270:
+      job.x = fb->height - y - height;
+      job.y = x;
+      job.width = height;
+      height = width;
+      break;
+    case 180:
+      job.x = fb->width - x - width;
+      job.y = fb->height - y - height;
+      job.width = width;
+      break;
+    case 90:
+      job.x = y;
+      job.y = fb->width - x - width;
+      job.width = height;
+      height = width;
+      break;
+    case 0:
+    default:
+      job.x = x;
+      job.y = y;
+      job.width = width;
+      break;
+    }
+
+  psplash_pool_run (job.width, height, flush_rect_band, &job);
 }
@@ -29,6 +29,15 @@ enum RGBMode {
     GENERIC,
 };
 
+// A glyph of some text, as laid out on screen
+typedef struct PSplashTextCell
+{
+  int      x, y, width, height;
+  wchar_t  wc;
+  uint8    red, green, blue;
+}
+PSplashTextCell;
+
 typedef struct PSplashFB
 {
   int            fd;			
@@ -41,6 +50,7 @@ typedef struct PSplashFB
   char          *data;      // actual fb data
   char          *data_buf;  // double-buffering optimization
   char          *base;
+  size_t         base_size;
 
   int            angle;
   int            real_width, real_height;
@@ -52,6 +62,8 @@ typedef struct PSplashFB
   int            green_length;
   int            blue_offset;
   int            blue_length;
+
+  int            hidden;    // VT switched away: drawing only goes to data_buf
 }
 PSplashFB;
 
@@ -113,8 +125,28 @@ psplash_fb_draw_text (PSplashFB         *fb,
 		      const PSplashFont *font,
 		      const char        *text);
 
+// Where psplash_fb_draw_text puts each glyph of text: stores up to
+// max_cells of them and returns how many there are
+int
+psplash_fb_text_cells (PSplashFB         *fb,
+		       int                x,
+		       int                y,
+		       uint8              red,
+		       uint8              green,
+		       uint8              blue,
+		       const PSplashFont *font,
+		       const char        *text,
+		       PSplashTextCell   *cells,
+		       int                max_cells);
+
+void
+psplash_fb_draw_cell (PSplashFB             *fb,
+		      int                    buffered,
+		      const PSplashFont     *font,
+		      const PSplashTextCell *cell);
+
 // Flush given region of local buffers to framebuffer
-// (applies only if buffered=1 has been used)
+// (applies only if buffered=1 has been used, and not while hidden)
 void
 psplash_fb_flush_rect (PSplashFB    *fb,
 		       int          x,
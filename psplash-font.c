@@ -0,0 +1,261 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Bitmap fonts loaded at run time: PSF2 files, as shipped with kbd.
+ *
+ *  The file is mapped read-only, so glyphs only take memory when drawn,
+ *  and the character index is built once at load.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-font.h"
+
+#define PSF2_MAGIC          0x864ab572
+#define PSF2_HAS_UNICODE    0x01
+#define PSF2_SEPARATOR      0xff
+#define PSF2_STARTSEQ       0xfe
+
+typedef struct Psf2Header
+{
+  u_int32_t magic;
+  u_int32_t version;
+  u_int32_t headersize;
+  u_int32_t flags;
+  u_int32_t length;         /* number of glyphs */
+  u_int32_t charsize;       /* bytes per glyph */
+  u_int32_t height, width;
+}
+Psf2Header;
+
+static int
+font_code_cmp (const void *a, const void *b)
+{
+  u_int32_t ca = ((const PSplashFontCode *) a)->code;
+  u_int32_t cb = ((const PSplashFontCode *) b)->code;
+
+  return (ca > cb) - (ca < cb);
+}
+
+/* Decodes one UTF-8 character, returns its length (0 if malformed) */
+static int
+font_utf8 (const uint8 *p, const uint8 *end, u_int32_t *code)
+{
+  int len, i;
+
+  if (p[0] < 0x80)
+    {
+      *code = p[0];
+      return 1;
+    }
+
+  if ((p[0] & 0xe0) == 0xc0)
+    len = 2, *code = p[0] & 0x1f;
+  else if ((p[0] & 0xf0) == 0xe0)
+    len = 3, *code = p[0] & 0x0f;
+  else if ((p[0] & 0xf8) == 0xf0)
+    len = 4, *code = p[0] & 0x07;
+  else
+    return 0;
+
+  if (end - p < len)
+    return 0;
+
+  for (i = 1; i < len; i++)
+    {
+      if ((p[i] & 0xc0) != 0x80)
+        return 0;
+      *code = (*code << 6) | (p[i] & 0x3f);
+    }
+
+  return len;
+}
+
+static void
+font_add_code (PSplashFontFile *file, u_int32_t code, int glyph)
+{
+  if (code < 256)
+    {
+      if (file->latin1[code] < 0)
+        file->latin1[code] = glyph;
+      return;
+    }
+
+  file->codes[file->ncodes].code  = code;
+  file->codes[file->ncodes].glyph = glyph;
+  file->ncodes++;
+}
+
+/* Builds the character index from the unicode table, which lists the
+ * characters of every glyph (and then sequences, not supported here) */
+static int
+font_index_unicode (PSplashFontFile *file, const uint8 *p, const uint8 *end)
+{
+  u_int32_t    code;
+  int          glyph, len;
+
+  /* Every character takes at least one byte */
+  if ((file->codes = malloc ((end - p + 1) * sizeof(PSplashFontCode))) == NULL)
+    return -1;
+
+  for (glyph = 0; glyph < file->nglyphs && p < end; glyph++)
+    {
+      /* Characters first */
+      while (p < end && *p != PSF2_SEPARATOR && *p != PSF2_STARTSEQ)
+        {
+          if ((len = font_utf8 (p, end, &code)) == 0)
+            return -1;
+          font_add_code (file, code, glyph);
+          p += len;
+        }
+
+      while (p < end && *p != PSF2_SEPARATOR)
+        p++;
+      p++;
+    }
+
+  qsort (file->codes, file->ncodes, sizeof(PSplashFontCode), font_code_cmp);
+  return 0;
+}
+
+int
+psplash_font_load (PSplashFont *font, const char *path)
+{
+  PSplashFontFile *file;
+  const Psf2Header *hdr;
+  struct stat      st;
+  size_t           glyphs_end;
+  int              fd, i;
+
+  if ((file = calloc (1, sizeof(PSplashFontFile))) == NULL)
+    return -1;
+
+  if ((fd = open (path, O_RDONLY | O_CLOEXEC)) < 0 || fstat (fd, &st)
+      || st.st_size < (off_t) sizeof(Psf2Header))
+    {
+      fprintf (stderr, "psplash: cannot open font %s\n", path);
+      goto fail_open;
+    }
+
+  file->map_size = st.st_size;
+  file->map = mmap (NULL, file->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  fd = -1;
+
+  if (file->map == MAP_FAILED)
+    {
+      perror ("font mmap");
+      goto fail_open;
+    }
+
+  hdr = file->map;
+
+  /* Divided rather than multiplied: a crafted header must not be able to
+   * wrap size_t on 32 bit targets */
+  if (hdr->magic != PSF2_MAGIC || hdr->headersize < sizeof(Psf2Header)
+      || hdr->headersize > file->map_size
+      || hdr->width == 0 || hdr->width > 32
+      || hdr->height == 0 || hdr->length == 0 || hdr->charsize == 0
+      || hdr->height > hdr->charsize / ((hdr->width + 7) / 8)
+      || hdr->length > (file->map_size - hdr->headersize) / hdr->charsize)
+    {
+      fprintf (stderr, "psplash: %s is not a usable PSF2 font\n", path);
+      goto fail;
+    }
+
+  glyphs_end = (size_t) hdr->headersize + (size_t) hdr->length * hdr->charsize;
+
+  file->glyphs     = (const uint8 *) file->map + hdr->headersize;
+  file->nglyphs    = hdr->length;
+  file->glyph_size = hdr->charsize;
+  file->row_bytes  = (hdr->width + 7) / 8;
+  file->width      = hdr->width;
+
+  for (i = 0; i < 256; i++)
+    file->latin1[i] = -1;
+
+  if (hdr->flags & PSF2_HAS_UNICODE)
+    {
+      if (font_index_unicode (file, (const uint8 *) file->map + glyphs_end,
+                              (const uint8 *) file->map + file->map_size))
+        {
+          fprintf (stderr, "psplash: bad unicode table in %s\n", path);
+          goto fail;
+        }
+    }
+  else
+    {
+      /* Glyphs in code point order */
+      for (i = 0; i < 256 && i < file->nglyphs; i++)
+        file->latin1[i] = i;
+    }
+
+  file->fallback = (file->latin1['?'] >= 0) ? file->latin1['?'] : 0;
+
+  memset (font, 0, sizeof(*font));
+  font->name   = (char *) path;
+  font->height = hdr->height;
+  font->file   = file;
+
+  return 0;
+
+fail:
+  munmap (file->map, file->map_size);
+fail_open:
+  if (fd >= 0)
+    close (fd);
+  free (file->codes);
+  free (file);
+  return -1;
+}
+
+void
+psplash_font_unload (PSplashFont *font)
+{
+  PSplashFontFile *file = font->file;
+
+  if (file == NULL)
+    return;
+
+  munmap (file->map, file->map_size);
+  free (file->codes);
+  free (file);
+  font->file = NULL;
+}
+
+void
+psplash_font_file_glyph (const PSplashFontFile *file, wchar_t wc, PSplashGlyph *glyph)
+{
+  PSplashFontCode  key, *found;
+  int              index = -1;
+
+  if (wc >= 0 && wc < 256)
+    index = file->latin1[wc];
+  else if (file->codes != NULL)
+    {
+      key.code = wc;
+      found = bsearch (&key, file->codes, file->ncodes, sizeof(PSplashFontCode),
+                       font_code_cmp);
+      if (found)
+        index = found->glyph;
+    }
+  else if (wc >= 0 && wc < file->nglyphs)
+    index = wc;
+
+  if (index < 0)
+    index = file->fallback;
+
+  glyph->rows      = file->glyphs + (size_t) index * file->glyph_size;
+  glyph->width     = file->width;
+  glyph->row_bytes = file->row_bytes;
+}
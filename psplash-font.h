@@ -0,0 +1,95 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Bitmap fonts loaded at run time: PSF2 files, as shipped with kbd.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_FONT_H
+#define _HAVE_PSPLASH_FONT_H
+
+#include "psplash.h"
+
+/* Environment variable naming the font, overridden by --font */
+#define PSPLASH_FONT_ENV  "PSPLASH_FONT"
+
+/* Row size of the built-in fonts' glyphs (see make-font-header.py) */
+#define PSPLASH_GLYPH_ROW_BYTES(width) \
+   (((width) <= 8) ? 1 : (((width) <= 16) ? 2 : 4))
+
+/* A glyph bitmap: one row after the other, MSB first (leftmost pixel) */
+typedef struct PSplashGlyph
+{
+  const uint8 *rows;
+  int          width;       /* in pixels */
+  int          row_bytes;
+}
+PSplashGlyph;
+
+/* Row of a glyph, left-aligned in 32 bits */
+static inline u_int32_t
+psplash_glyph_row (const PSplashGlyph *glyph, int row)
+{
+  const uint8 *p = glyph->rows + row * glyph->row_bytes;
+  u_int32_t    bits = 0;
+  int          i;
+
+  switch (glyph->row_bytes)
+    {
+    case 1:
+      return (u_int32_t) p[0] << 24;
+    case 2:
+      return ((u_int32_t) p[0] << 24) | ((u_int32_t) p[1] << 16);
+    default:
+      for (i = 0; i < glyph->row_bytes; i++)
+        bits |= (u_int32_t) p[i] << (24 - 8 * i);
+      return bits;
+    }
+}
+
+typedef struct PSplashFontCode
+{
+  u_int32_t code;
+  int       glyph;
+}
+PSplashFontCode;
+
+/* The mapped file and its character index, built once at load */
+typedef struct PSplashFontFile
+{
+  void            *map;
+  size_t           map_size;
+  const uint8     *glyphs;
+  int              nglyphs;
+  int              glyph_size;    /* bytes per glyph */
+  int              row_bytes;
+  int              width;
+  int              latin1[256];   /* glyph of the first code points, -1 if none */
+  PSplashFontCode *codes;         /* the others, sorted */
+  int              ncodes;
+  int              fallback;      /* glyph for missing characters */
+}
+PSplashFontFile;
+
+/* Maps a PSF2 font into font: 0 on success, -1 on failure */
+int
+psplash_font_load (PSplashFont *font, const char *path);
+
+void
+psplash_font_unload (PSplashFont *font);
+
+/* Looks up wc in a loaded font, the fallback glyph if it has none */
+void
+psplash_font_file_glyph (const PSplashFontFile *file, wchar_t wc, PSplashGlyph *glyph);
+
+#endif
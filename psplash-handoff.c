@@ -0,0 +1,71 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Handoff record, psplash side.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-handoff.h"
+
+#define PSPLASH_HANDOFF_TMP  PSPLASH_HANDOFF ".new"
+
+int
+psplash_handoff_write (PSplashHandoff *rec)
+{
+  PSplashHandoff *h;
+  int             fd;
+
+  if ((fd = open (PSPLASH_HANDOFF_TMP, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)) < 0)
+    {
+      perror ("handoff open");
+      return -1;
+    }
+
+  if (ftruncate (fd, sizeof(PSplashHandoff)))
+    {
+      perror ("handoff truncate");
+      goto fail;
+    }
+
+  h = mmap (NULL, sizeof(PSplashHandoff), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (h == MAP_FAILED)
+    {
+      perror ("handoff mmap");
+      goto fail;
+    }
+
+  rec->magic   = PSPLASH_HANDOFF_MAGIC;
+  rec->version = PSPLASH_HANDOFF_VERSION;
+  rec->size    = sizeof(PSplashHandoff);
+  rec->msg[PSPLASH_HANDOFF_MSG_LEN - 1] = '\0';
+  memcpy (h, rec, sizeof(PSplashHandoff));
+
+  munmap (h, sizeof(PSplashHandoff));
+  close (fd);
+
+  if (rename (PSPLASH_HANDOFF_TMP, PSPLASH_HANDOFF))
+    {
+      perror ("handoff rename");
+      unlink (PSPLASH_HANDOFF_TMP);
+      return -1;
+    }
+
+  return 0;
+
+fail:
+  close (fd);
+  unlink (PSPLASH_HANDOFF_TMP);
+  return -1;
+}
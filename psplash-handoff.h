@@ -0,0 +1,122 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Handoff record, left at QUIT for the next-stage splash (xsplash).
+ *
+ *  It holds the state of the progress bar, with the time it was sampled
+ *  at, the last message and the screen geometry, so the next stage can
+ *  carry on the animation where psplash left it:
+ *
+ *    const PSplashHandoff *h = psplash_handoff_open ();
+ *    if (h && h->mode == PSPLASH_HANDOFF_INFINITE)
+ *      offset = h->progress + (now_ms - h->timestamp_ms) * h->speed / 1000;
+ *    psplash_handoff_close (h);
+ *
+ *  The record is written to a temporary file renamed over PSPLASH_HANDOFF,
+ *  so readers either find a complete one or none.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_HANDOFF_H
+#define _HAVE_PSPLASH_HANDOFF_H
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define PSPLASH_HANDOFF          "/tmp/splash_handoff"
+#define PSPLASH_HANDOFF_MAGIC    0x50534831     /* "PSH1" */
+#define PSPLASH_HANDOFF_VERSION  1
+#define PSPLASH_HANDOFF_MSG_LEN  256
+
+enum PSplashHandoffMode
+{
+  PSPLASH_HANDOFF_NONE,           /* no progress bar */
+  PSPLASH_HANDOFF_DETERMINATE,    /* progress is the last PROGRESS value */
+  PSPLASH_HANDOFF_INFINITE,       /* progress is the bar offset in the box */
+};
+
+typedef struct PSplashHandoff
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;                  /* of the record, later versions append */
+  uint32_t mode;
+  int32_t  progress;
+  int32_t  speed;                 /* of the infinite bar, in pixels/s */
+  int64_t  timestamp_ms;          /* CLOCK_MONOTONIC time of progress */
+
+  /* Progress box, and moving bar width, in screen coordinates */
+  int32_t  bar_x, bar_y, bar_width, bar_height;
+  int32_t  bar_size;
+
+  /* Screen, as drawn by psplash (width and height after rotation) */
+  int32_t  width, height;
+  int32_t  bpp, stride;
+  int32_t  angle;
+  int32_t  rgbmode;               /* enum RGBMode in psplash-fb.h */
+
+  char     msg[PSPLASH_HANDOFF_MSG_LEN];
+}
+PSplashHandoff;
+
+/* Maps the record left by psplash, NULL if there is none. A file too
+ * short for the record (older version, crash before it was filled in) is
+ * none either: reading past its end would raise SIGBUS. */
+static inline const PSplashHandoff *
+psplash_handoff_open (void)
+{
+  PSplashHandoff *h;
+  struct stat     st;
+  int             fd;
+
+  if ((fd = open (PSPLASH_HANDOFF, O_RDONLY | O_CLOEXEC)) < 0)
+    return NULL;
+
+  if (fstat (fd, &st) < 0 || st.st_size < (off_t) sizeof(PSplashHandoff))
+    {
+      close (fd);
+      return NULL;
+    }
+
+  h = mmap (NULL, sizeof(PSplashHandoff), PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (h == MAP_FAILED)
+    return NULL;
+
+  if (h->magic != PSPLASH_HANDOFF_MAGIC || h->version != PSPLASH_HANDOFF_VERSION
+      || h->size < sizeof(PSplashHandoff))
+    {
+      munmap (h, sizeof(PSplashHandoff));
+      return NULL;
+    }
+
+  return h;
+}
+
+static inline void
+psplash_handoff_close (const PSplashHandoff *h)
+{
+  if (h)
+    munmap ((void *) h, sizeof(PSplashHandoff));
+}
+
+/* psplash side (psplash-handoff.c): writes rec as PSPLASH_HANDOFF,
+ * filling in magic, version and size. Returns 0 on success. */
+int
+psplash_handoff_write (PSplashHandoff *rec);
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Worker pool splitting full-screen operations into horizontal bands.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-pool.h"
+#include <pthread.h>
+
+static struct
+{
+  int              nthreads;        /* workers + caller */
+  pthread_t        thread[PSPLASH_POOL_MAX_THREADS];
+  pthread_mutex_t  lock;
+  pthread_cond_t   work;
+  pthread_cond_t   done;
+  unsigned int     generation;
+  int              quit;
+
+  /* current job */
+  PSplashBandFunc  func;
+  void            *data;
+  int              height;
+  int              nbands;
+  int              next;            /* next band to be taken */
+  int              pending;         /* bands not finished yet */
+}
+Pool =
+{
+  .nthreads = 1,
+  .lock     = PTHREAD_MUTEX_INITIALIZER,
+  .work     = PTHREAD_COND_INITIALIZER,
+  .done     = PTHREAD_COND_INITIALIZER,
+};
+
+/* Takes and processes bands of the current job, called with lock held */
+static void
+pool_do_bands (void)
+{
+  while (Pool.next < Pool.nbands)
+    {
+      int band = Pool.next++;
+      int y0   = (Pool.height * band) / Pool.nbands;
+      int y1   = (Pool.height * (band + 1)) / Pool.nbands;
+
+      pthread_mutex_unlock (&Pool.lock);
+      Pool.func (Pool.data, y0, y1);
+      pthread_mutex_lock (&Pool.lock);
+
+      if (--Pool.pending == 0)
+        pthread_cond_signal (&Pool.done);
+    }
+}
+
+static void *
+pool_worker (void *arg)
+{
+  unsigned int seen = 0;
+
+  pthread_mutex_lock (&Pool.lock);
+  for (;;)
+    {
+      while (!Pool.quit && Pool.generation == seen)
+        pthread_cond_wait (&Pool.work, &Pool.lock);
+
+      if (Pool.quit)
+        break;
+
+      seen = Pool.generation;
+      pool_do_bands ();
+    }
+  pthread_mutex_unlock (&Pool.lock);
+
+  return NULL;
+}
+
+void
+psplash_pool_init (int nthreads)
+{
+  int i;
+
+  if (nthreads <= 0)
+    nthreads = sysconf (_SC_NPROCESSORS_ONLN);
+
+  nthreads = CLAMP(nthreads, 1, PSPLASH_POOL_MAX_THREADS);
+
+  /* The caller always takes part, so only nthreads - 1 workers */
+  Pool.nthreads = 1;
+  for (i = 1; i < nthreads; i++)
+    {
+      if (pthread_create (&Pool.thread[i], NULL, pool_worker, NULL))
+        break;
+      Pool.nthreads++;
+    }
+
+  DBG("%i rendering threads", Pool.nthreads);
+}
+
+void
+psplash_pool_destroy (void)
+{
+  int i;
+
+  pthread_mutex_lock (&Pool.lock);
+  Pool.quit = TRUE;
+  pthread_cond_broadcast (&Pool.work);
+  pthread_mutex_unlock (&Pool.lock);
+
+  for (i = 1; i < Pool.nthreads; i++)
+    pthread_join (Pool.thread[i], NULL);
+
+  Pool.nthreads = 1;
+}
+
+void
+psplash_pool_run (int width, int height, PSplashBandFunc func, void *data)
+{
+  if (height <= 0)
+    return;
+
+  if (Pool.nthreads < 2 || height < Pool.nthreads
+      || width * height < PSPLASH_POOL_MIN_PIXELS)
+    {
+      func (data, 0, height);
+      return;
+    }
+
+  pthread_mutex_lock (&Pool.lock);
+
+  Pool.func    = func;
+  Pool.data    = data;
+  Pool.height  = height;
+  Pool.nbands  = Pool.nthreads;
+  Pool.next    = 0;
+  Pool.pending = Pool.nbands;
+  Pool.generation++;
+  pthread_cond_broadcast (&Pool.work);
+
+  pool_do_bands ();
+
+  while (Pool.pending > 0)
+    pthread_cond_wait (&Pool.done, &Pool.lock);
+
+  pthread_mutex_unlock (&Pool.lock);
+}
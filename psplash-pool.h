@@ -0,0 +1,43 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Worker pool splitting full-screen operations into horizontal bands.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_POOL_H
+#define _HAVE_PSPLASH_POOL_H
+
+#define PSPLASH_POOL_MAX_THREADS  8
+
+/* Operations smaller than this (in pixels) are not worth waking workers */
+#define PSPLASH_POOL_MIN_PIXELS   (64 * 1024)
+
+/* Processes rows [y0, y1) */
+typedef void (*PSplashBandFunc) (void *data, int y0, int y1);
+
+/* Starts the pool with the given number of threads (including the caller),
+ * 0 meaning one per online CPU. No thread is spawned when this is 1. */
+void
+psplash_pool_init (int nthreads);
+
+void
+psplash_pool_destroy (void);
+
+/* Runs func over rows [0, height) split in bands, returns when all bands
+ * are done. Small jobs (width * height < PSPLASH_POOL_MIN_PIXELS) and
+ * single-thread pools run in the caller only. */
+void
+psplash_pool_run (int width, int height, PSplashBandFunc func, void *data);
+
+#endif
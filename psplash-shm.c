@@ -0,0 +1,103 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Shared-memory progress channel, psplash side.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-shm.h"
+
+/* Attempts before giving up on a snapshot for this frame */
+#define PSPLASH_SHM_TRIES  4
+
+PSplashShm *
+psplash_shm_create (void)
+{
+  PSplashShm *shm;
+  int         fd;
+
+  if ((fd = open (PSPLASH_SHM, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP)) < 0)
+    {
+      perror ("shm open");
+      return NULL;
+    }
+
+  if (ftruncate (fd, sizeof(PSplashShm)))
+    {
+      perror ("shm truncate");
+      close (fd);
+      return NULL;
+    }
+
+  shm = mmap (NULL, sizeof(PSplashShm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (shm == MAP_FAILED)
+    {
+      perror ("shm mmap");
+      unlink (PSPLASH_SHM);
+      return NULL;
+    }
+
+  /* The file is zero filled, the magic makes it valid for producers */
+  __atomic_store_n (&shm->magic, PSPLASH_SHM_MAGIC, __ATOMIC_RELEASE);
+
+  return shm;
+}
+
+void
+psplash_shm_destroy (PSplashShm *shm)
+{
+  if (shm == NULL)
+    return;
+
+  unlink (PSPLASH_SHM);
+  munmap (shm, sizeof(PSplashShm));
+}
+
+int
+psplash_shm_snapshot (PSplashShm *shm, uint32_t *seq, PSplashShm *snap)
+{
+  uint32_t begin;
+  int      i;
+
+  for (i = 0; i < PSPLASH_SHM_TRIES; i++)
+    {
+      begin = __atomic_load_n (&shm->seq, __ATOMIC_ACQUIRE);
+
+      if (begin == *seq)
+        return 0;
+
+      if (begin & 1)
+        continue;
+
+      snap->progress_seq = shm->progress_seq;
+      snap->progress     = shm->progress;
+      snap->msg_seq      = shm->msg_seq;
+      memcpy (snap->msg, shm->msg, sizeof(snap->msg));
+
+      /* Data reads must complete before the sequence number is checked */
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+
+      if (__atomic_load_n (&shm->seq, __ATOMIC_RELAXED) == begin)
+        {
+          snap->msg[PSPLASH_SHM_MSG_LEN - 1] = '\0';
+          *seq = begin;
+          return 1;
+        }
+    }
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Shared-memory progress channel, for producers updating the progress
+ *  faster than it makes sense to write commands to the FIFO.
+ *
+ *  psplash (started with --shm) creates PSPLASH_SHM in $TMPDIR and samples
+ *  it once per frame, so only the latest state is drawn. Producers map it
+ *  once with psplash_shm_attach() and then update it without any syscall:
+ *
+ *    PSplashShm *shm = psplash_shm_attach ();
+ *    if (shm)
+ *      psplash_shm_set_progress (shm, 42);
+ *
+ *  Updates are guarded by a seqlock: the sequence number is odd while an
+ *  update is in progress. Concurrent producers serialize on it by spinning,
+ *  so updates must be short and a producer must not be stopped halfway.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_SHM_H
+#define _HAVE_PSPLASH_SHM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define PSPLASH_SHM          "psplash_shm"
+#define PSPLASH_SHM_MAGIC    0x50534d31     /* "PSM1" */
+#define PSPLASH_SHM_MSG_LEN  256
+
+typedef struct PSplashShm
+{
+  uint32_t magic;
+  uint32_t seq;                   /* seqlock, odd while being updated */
+  uint32_t progress_seq;          /* bumped on every progress update */
+  int32_t  progress;
+  uint32_t msg_seq;               /* bumped on every message update */
+  char     msg[PSPLASH_SHM_MSG_LEN];
+}
+PSplashShm;
+
+/* Maps the channel created by psplash, NULL if psplash doesn't provide it */
+static inline PSplashShm *
+psplash_shm_attach (void)
+{
+  char        path[512];
+  const char *tmpdir = getenv ("TMPDIR");
+  PSplashShm *shm;
+  int         fd;
+
+  snprintf (path, sizeof(path), "%s/" PSPLASH_SHM, tmpdir ? tmpdir : "/tmp");
+
+  if ((fd = open (path, O_RDWR | O_CLOEXEC)) < 0)
+    return NULL;
+
+  shm = mmap (NULL, sizeof(PSplashShm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+
+  if (shm == MAP_FAILED)
+    return NULL;
+
+  if (shm->magic != PSPLASH_SHM_MAGIC)
+    {
+      munmap (shm, sizeof(PSplashShm));
+      return NULL;
+    }
+
+  return shm;
+}
+
+static inline void
+psplash_shm_lock (PSplashShm *shm)
+{
+  uint32_t seq;
+
+  for (;;)
+    {
+      seq = __atomic_load_n (&shm->seq, __ATOMIC_RELAXED);
+      if (!(seq & 1) &&
+          __atomic_compare_exchange_n (&shm->seq, &seq, seq + 1, 0,
+                                       __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        break;
+    }
+
+  /* The odd sequence number must be visible before any of the data */
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+}
+
+static inline void
+psplash_shm_unlock (PSplashShm *shm)
+{
+  __atomic_fetch_add (&shm->seq, 1, __ATOMIC_RELEASE);
+}
+
+static inline void
+psplash_shm_set_progress (PSplashShm *shm, int value)
+{
+  psplash_shm_lock (shm);
+  shm->progress = value;
+  shm->progress_seq++;
+  psplash_shm_unlock (shm);
+}
+
+static inline void
+psplash_shm_set_msg (PSplashShm *shm, const char *msg)
+{
+  psplash_shm_lock (shm);
+  strncpy (shm->msg, msg, PSPLASH_SHM_MSG_LEN - 1);
+  shm->msg[PSPLASH_SHM_MSG_LEN - 1] = '\0';
+  shm->msg_seq++;
+  psplash_shm_unlock (shm);
+}
+
+/* psplash side (psplash-shm.c) */
+
+/* Creates PSPLASH_SHM in the current directory */
+PSplashShm *
+psplash_shm_create (void);
+
+void
+psplash_shm_destroy (PSplashShm *shm);
+
+/* Copies a consistent snapshot of shm into snap, unless it didn't change
+ * since *seq. Returns 1 and updates *seq when a new snapshot was taken,
+ * 0 if nothing changed or a producer is busy (retry on next frame). */
+int
+psplash_shm_snapshot (PSplashShm *shm, uint32_t *seq, PSplashShm *snap);
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Small dependency-driven task runner, used to overlap the independent
+ *  (mostly I/O bound) startup and shutdown stages.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "psplash.h"
+#include "psplash-tasks.h"
+#include <time.h>
+
+void
+psplash_tasks_init (PSplashTasks *tasks)
+{
+  memset (tasks, 0, sizeof(PSplashTasks));
+  pthread_mutex_init (&tasks->lock, NULL);
+  pthread_cond_init (&tasks->cond, NULL);
+}
+
+void
+psplash_tasks_destroy (PSplashTasks *tasks)
+{
+  pthread_cond_destroy (&tasks->cond);
+  pthread_mutex_destroy (&tasks->lock);
+}
+
+int
+psplash_tasks_add (PSplashTasks    *tasks,
+                   const char      *name,
+                   PSplashTaskFunc  func,
+                   void            *data,
+                   unsigned int     deps)
+{
+  PSplashTask *task;
+  int          id = tasks->ntasks;
+
+  if (id >= PSPLASH_TASKS_MAX)
+    {
+      fprintf(stderr, "psplash: too many tasks, dropping %s\n", name);
+      return -1;
+    }
+
+  /* Only backward references, so that the graph can't deadlock */
+  deps &= PSPLASH_TASK_DEP(id) - 1;
+
+  task = &tasks->task[id];
+  task->name  = name;
+  task->func  = func;
+  task->data  = data;
+  task->deps  = deps;
+  task->owner = tasks;
+
+  tasks->ntasks++;
+
+  return id;
+}
+
+static long
+elapsed_usecs (struct timespec *start)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+
+  return (now.tv_sec - start->tv_sec) * 1000000L
+    + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+static void *
+task_runner (void *arg)
+{
+  PSplashTask     *task  = arg;
+  PSplashTasks    *tasks = task->owner;
+  struct timespec  start;
+
+  pthread_mutex_lock (&tasks->lock);
+  while ((tasks->done & task->deps) != task->deps)
+    pthread_cond_wait (&tasks->cond, &tasks->lock);
+  pthread_mutex_unlock (&tasks->lock);
+
+  clock_gettime (CLOCK_MONOTONIC, &start);
+  task->result = task->func (task->data);
+  task->usecs  = elapsed_usecs (&start);
+
+  DBG("task %s: %i, %li us", task->name, task->result, task->usecs);
+
+  pthread_mutex_lock (&tasks->lock);
+  tasks->done |= PSPLASH_TASK_DEP(task - tasks->task);
+  pthread_cond_broadcast (&tasks->cond);
+  pthread_mutex_unlock (&tasks->lock);
+
+  return NULL;
+}
+
+int
+psplash_tasks_run (PSplashTasks *tasks)
+{
+  int i, failed = 0;
+
+  for (i = 0; i < tasks->ntasks; i++)
+    {
+      PSplashTask *task = &tasks->task[i];
+
+      task->threaded = (pthread_create (&task->thread, NULL,
+                                        task_runner, task) == 0);
+
+      /* Fall back to running in our own context; every dependency is
+       * either already done or owned by a running thread. */
+      if (!task->threaded)
+        task_runner (task);
+    }
+
+  for (i = 0; i < tasks->ntasks; i++)
+    {
+      PSplashTask *task = &tasks->task[i];
+
+      if (task->threaded)
+        pthread_join (task->thread, NULL);
+
+      if (task->result)
+        failed++;
+    }
+
+  return failed;
+}
@@ -0,0 +1,75 @@
+/*
+ *  pslash - a lightweight framebuffer splashscreen for embedded devices.
+ *
+ *  Small dependency-driven task runner, used to overlap the independent
+ *  (mostly I/O bound) startup and shutdown stages.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_PSPLASH_TASKS_H
+#define _HAVE_PSPLASH_TASKS_H
+
+#include <pthread.h>
+
+#define PSPLASH_TASKS_MAX  16
+
+/* Dependency mask bit for the task id returned by psplash_tasks_add() */
+#define PSPLASH_TASK_DEP(id) (1u << (id))
+
+typedef int (*PSplashTaskFunc) (void *data);
+
+typedef struct PSplashTask
+{
+  const char          *name;
+  PSplashTaskFunc      func;
+  void                *data;
+  unsigned int         deps;      /* mask of tasks which must finish first */
+  int                  result;    /* return value of func */
+  long                 usecs;     /* run time of func */
+  pthread_t            thread;
+  int                  threaded;
+  struct PSplashTasks *owner;
+}
+PSplashTask;
+
+typedef struct PSplashTasks
+{
+  PSplashTask      task[PSPLASH_TASKS_MAX];
+  int              ntasks;
+  unsigned int     done;          /* mask of finished tasks */
+  pthread_mutex_t  lock;
+  pthread_cond_t   cond;
+}
+PSplashTasks;
+
+void
+psplash_tasks_init (PSplashTasks *tasks);
+
+/* Adds a task, deps may only reference previously added tasks.
+ * Returns the task id, or -1 if the table is full. */
+int
+psplash_tasks_add (PSplashTasks    *tasks,
+                   const char      *name,
+                   PSplashTaskFunc  func,
+                   void            *data,
+                   unsigned int     deps);
+
+/* Runs every task as soon as its dependencies are done and waits for all
+ * of them. Returns the number of tasks whose func returned non-zero. */
+int
+psplash_tasks_run (PSplashTasks *tasks);
+
+void
+psplash_tasks_destroy (PSplashTasks *tasks);
+
+#endif
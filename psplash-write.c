@@ -25,53 +25,220 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "psplash.h"
 #include "common.h"
 
+/* How long a command waits for room in the FIFO while psplash is busy
+ * elsewhere (tap-tap menus, reboot, exit) before it is given up on */
+#define PSPLASH_WRITE_TIMEOUT_MS 1000
+
+/* The FIFO stays non blocking: 0 once all of buf is in, -1 when psplash
+ * went away or didn't drain it in time */
+static int
+fifo_write (int fd, const char *buf, size_t len)
+{
+  struct pollfd pfd;
+  ssize_t       n;
+
+  pfd.fd = fd;
+  pfd.events = POLLOUT;
+
+  while (len > 0)
+    {
+      n = write(fd, buf, len);
+      if (n > 0)
+        {
+          buf += n;
+          len -= n;
+          continue;
+        }
+
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n < 0 && errno != EAGAIN)
+        return -1;
+
+      if (poll(&pfd, 1, PSPLASH_WRITE_TIMEOUT_MS) <= 0
+          || (pfd.revents & (POLLERR | POLLHUP)))
+        return -1;
+    }
+
+  return 0;
+}
+
+/* Sends a NUL terminated command: 0 on success. Once psplash is gone
+ * (no reader, or it quit meanwhile) the fifo is dropped, and a QUIT is
+ * handled by ourselves instead. */
+static int
+process_command (int *pipe_fd, const char *command)
+{
+  size_t len = strlen(command) + 1;
+
+  if (*pipe_fd >= 0)
+    {
+      errno = 0;
+      if (fifo_write(*pipe_fd, command, len) == 0)
+        return 0;
+
+      //no need for verbose failures
+      //perror("write");
+      close(*pipe_fd);
+      *pipe_fd = -1;
+    }
+
+  /* if psplash is down we handle shutdown ourselves */
+  if (strcmp(command,"QUIT") == 0)
+    setbootcounter(0);
+
+  return -1;
+}
+
+/* Control socket variant: waits for the reply and prints it, 0 on "OK" */
+static int
+socket_command (int sock_fd, const char *command)
+{
+  char    reply[256];
+  ssize_t n;
+
+  if (send(sock_fd, command, strlen(command) + 1, 0) < 0 ||
+      (n = recv(sock_fd, reply, sizeof(reply) - 1, 0)) <= 0)
+    {
+      /* Same as the FIFO: a QUIT is ours once psplash is gone */
+      if (strcmp(command,"QUIT") == 0)
+        setbootcounter(0);
+      return -1;
+    }
+
+  reply[n] = '\0';
+  printf("%s\n", reply);
+
+  return strncmp(reply, "OK", 2) ? -1 : 0;
+}
+
+static int
+socket_open (void)
+{
+  struct sockaddr_un addr;
+  int                fd;
+
+  if ((fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0)) < 0)
+    return -1;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, PSPLASH_SOCKET, sizeof(addr.sun_path) - 1);
+
+  if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)))
+    {
+      close(fd);
+      return -1;
+    }
+
+  return fd;
+}
+
+static void
+usage (const char *name)
+{
+  fprintf(stderr, "Usage: %s [-s|--socket] <command> [<command>...]\n"
+                  "       %s [-s|--socket] -   (one command per line from stdin)\n"
+                  "  -s: use the control socket, printing a reply per command\n"
+                  "      (\"OK <time>\" or \"ERR <reason>\"); SYNC waits for the display\n",
+                  name, name);
+}
+
+static int
+send_command (int *pipe_fd, int sock_fd, const char *command)
+{
+  if (sock_fd >= 0)
+    return socket_command(sock_fd, command);
+
+  return process_command(pipe_fd, command);
+}
+
 int main(int argc, char **argv) 
 {
   char *tmpdir;
-  char *command;
-  int   pipe_fd;
+  int   pipe_fd, sock_fd = -1;
+  int   i, first = 1, ret = 0;
+  bool  use_socket = FALSE, from_stdin;
 
   tmpdir = getenv("TMPDIR");
 
   if (!tmpdir)
     tmpdir = "/tmp";
 
-  if (argc!=2) 
+  if (argc > 1 && (!strcmp(argv[1], "-s") || !strcmp(argv[1], "--socket")))
+    {
+      use_socket = TRUE;
+      first++;
+    }
+
+  if (argc < first + 1) 
     {
       fprintf(stderr, "Wrong number of arguments\n");
+      usage(argv[0]);
       exit(-1);
     }
 
-  command = argv[1];
-  
+  from_stdin = (argc == first + 1 && strcmp(argv[first], "-") == 0);
+
   errno = 0;
   if (chdir(tmpdir)) {
     perror("chdir");
     exit(-1);
   }
-  
-  if ((pipe_fd = open (PSPLASH_FIFO,O_WRONLY|O_NONBLOCK)) == -1)
+
+  /* psplash going away while we write must not kill us, the remaining
+   * commands still have to be looked at for QUIT */
+  signal(SIGPIPE, SIG_IGN);
+
+  /* Silently error out instead of covering the boot process in 
+     errors when psplash has exitted due to a VC switch (it stays
+     around only when started with --keep-on-vt-switch) */
+  if (use_socket)
     {
-      /* if psplash is down we handle shutdown ourselves */
-      if (strcmp(command,"QUIT") == 0)
-        setbootcounter(0);
+      pipe_fd = -1;
+      sock_fd = socket_open();
+    }
+  else
+    pipe_fd = open (PSPLASH_FIFO,O_WRONLY|O_NONBLOCK);
+
+  if (from_stdin)
+    {
+      char   *line = NULL;
+      size_t  len = 0;
+      ssize_t n;
 
-      /* Silently error out instead of covering the boot process in 
-         errors when psplash has exitted due to a VC switch */
-      /* perror("Error unable to open fifo"); */
-      exit (-1);
+      while ((n = getline(&line, &len, stdin)) != -1)
+        {
+          if (n > 0 && line[n-1] == '\n')
+            line[--n] = '\0';
+          if (n == 0)
+            continue;
+
+          if (send_command(&pipe_fd, sock_fd, line))
+            ret = -1;
+        }
+      free(line);
+    }
+  else
+    {
+      for (i = first; i < argc; i++)
+        {
+          if (send_command(&pipe_fd, sock_fd, argv[i]))
+            ret = -1;
+        }
     }
 
-  errno = 0;
-  if (write(pipe_fd, command, strlen(command)+1) < 0) {
-    //no need for verbose failures
-    //perror("write");
-    exit(-1);
-  }
+  if (pipe_fd >= 0)
+    close(pipe_fd);
+  if (sock_fd >= 0)
+    close(sock_fd);
 
-  return 0;
+  return ret;
 }
-
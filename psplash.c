@@ -24,7 +24,17 @@
 #include "radeon-font.h"
 #include "customizations.h"
 #include "common.h"
+#include "psplash-tasks.h"
+#include "psplash-pool.h"
+#include "psplash-shm.h"
+#include "psplash-ctl.h"
+#include "psplash-font.h"
+#include "psplash-handoff.h"
+#include <pthread.h>
 #include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
 
 #define PROGRESS_FILE "/tmp/splash_progress"
 
@@ -33,55 +43,204 @@ int FONT_SCALE;
 bool disable_progress_bar = FALSE;
 bool fastboot_enable = FALSE;
 bool wu16_machine = FALSE;
+// Keep running when another process takes the VT, instead of exiting
+static bool keep_on_vt_switch = FALSE;
 volatile sig_atomic_t sig_flag = 0;
 
-void
-psplash_exit (int signum)
+// Message font: the built-in one, unless a font file is given
+static PSplashFont  loaded_font;
+static const PSplashFont *psplash_font = &radeon_font;
+
+static long
+psplash_now_ms (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000L + now.tv_nsec / 1000000;
+}
+
+// Glyph cells of the message on screen, to redraw only the ones that change
+#define PSPLASH_MSG_CELLS 256
+
+static PSplashTextCell msg_cells[PSPLASH_MSG_CELLS];
+static int             msg_ncells = -1;     /* -1: redraw the whole band */
+static int             msg_height;
+static const uint8    *msg_bg;
+
+static bool
+psplash_same_cell (const PSplashTextCell *a, const PSplashTextCell *b)
+{
+    return a->width == b->width && a->wc == b->wc
+        && a->red == b->red && a->green == b->green && a->blue == b->blue;
+}
+
+static void
+psplash_damage (int *box, const PSplashTextCell *cell)
+{
+    box[0] = MIN(box[0], cell->x);
+    box[1] = MIN(box[1], cell->y);
+    box[2] = MAX(box[2], cell->x + cell->width);
+    box[3] = MAX(box[3], cell->y + cell->height);
+}
+
+/*
+ * Redraws the cells that differ from the ones on screen. Both lists are in
+ * drawing order, i.e. sorted by line then x. Every cleared cell is cleared
+ * before any is drawn, as proportional glyphs may overlap old ones.
+ */
+static void
+psplash_update_msg_cells (PSplashFB *fb, PSplashTextCell *cells, int ncells,
+                          uint8 red, uint8 green, uint8 blue)
 {
-    DBG("Exit Step #1");
-    sig_flag = 1;
+    int box[4] = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+    int i, j, pass;
+
+    for (pass = 0; pass < 2; pass++)
+        for (i = j = 0; i < msg_ncells || j < ncells; )
+        {
+            PSplashTextCell *old = (i < msg_ncells) ? &msg_cells[i] : NULL;
+            PSplashTextCell *cur = (j < ncells) ? &cells[j] : NULL;
+
+            if (old && cur && old->y == cur->y && old->x == cur->x)
+            {
+                if (!psplash_same_cell (old, cur))
+                {
+                    if (pass == 0)
+                    {
+                        psplash_fb_draw_rect (fb, 1, old->x, old->y, old->width, old->height,
+                                              red, green, blue);
+                        psplash_fb_draw_rect (fb, 1, cur->x, cur->y, cur->width, cur->height,
+                                              red, green, blue);
+                        psplash_damage (box, old);
+                        psplash_damage (box, cur);
+                    }
+                    else
+                        psplash_fb_draw_cell (fb, 1, psplash_font, cur);
+                }
+                i++, j++;
+            }
+            else if (old && (!cur || old->y < cur->y
+                             || (old->y == cur->y && old->x < cur->x)))
+            {
+                if (pass == 0)
+                {
+                    psplash_fb_draw_rect (fb, 1, old->x, old->y, old->width, old->height,
+                                          red, green, blue);
+                    psplash_damage (box, old);
+                }
+                i++;
+            }
+            else
+            {
+                if (pass == 0)
+                {
+                    psplash_fb_draw_rect (fb, 1, cur->x, cur->y, cur->width, cur->height,
+                                          red, green, blue);
+                    psplash_damage (box, cur);
+                }
+                else
+                    psplash_fb_draw_cell (fb, 1, psplash_font, cur);
+                j++;
+            }
+        }
+
+    if (box[2] > box[0])
+        psplash_fb_flush_rect (fb, box[0], box[1], box[2] - box[0], box[3] - box[1]);
 }
 
+/*
+ * The message is composed in the back buffer and shown with one flush, so it
+ * never flashes the background. Once the band is up, only the glyphs that
+ * changed are redrawn, e.g. the tap-tap countdown digit.
+ */
 void
 psplash_draw_msg (PSplashFB *fb, const char *msg)
 {
-    int w, h;
+    PSplashTextCell cells[PSPLASH_MSG_CELLS];
+    static const uint8 bk[3] = { PSPLASH_TEXTBK_COLOR };
+    static const uint8 bk_fb[3] = { PSPLASH_TEXTBK_COLOR_FB };
+    const uint8 *bg = (FALSE == fastboot_enable || FALSE == wu16_machine) ? bk : bk_fb;
+    int w, h, ncells;
 
-    psplash_fb_text_size (fb, &w, &h, &radeon_font, msg);
+    psplash_fb_text_size (fb, &w, &h, psplash_font, msg);
 
     DBG("displaying '%s' %ix%i\n", msg, w, h);
 
+    ncells = psplash_fb_text_cells (fb, (fb->width-w)/2, 15, PSPLASH_TEXT_COLOR,
+                                    psplash_font, msg, cells, PSPLASH_MSG_CELLS);
+
+    if (ncells <= PSPLASH_MSG_CELLS && msg_ncells >= 0 && h == msg_height && bg == msg_bg)
+    {
+        psplash_update_msg_cells (fb, cells, ncells, bg[0], bg[1], bg[2]);
+        memcpy (msg_cells, cells, ncells * sizeof(PSplashTextCell));
+        msg_ncells = ncells;
+        return;
+    }
+
     /* Clear */
-    if( FALSE == fastboot_enable || FALSE == wu16_machine)
-        psplash_fb_draw_rect (fb,
-                              0,
-                              0,
-                              10,
-                              fb->width,
-                              h+10,
-                              PSPLASH_TEXTBK_COLOR);
-    else
-        psplash_fb_draw_rect (fb,
-                              0,
-                              0,
-                              10,
-                              fb->width,
-                              h+10,
-                              PSPLASH_TEXTBK_COLOR_FB);
+    psplash_fb_draw_rect (fb,
+                          1,
+                          0,
+                          10,
+                          fb->width,
+                          h+10,
+                          bg[0], bg[1], bg[2]);
 
     psplash_fb_draw_text (fb,
-                          0,
+                          1,
                           (fb->width-w)/2,
                           15,
                           PSPLASH_TEXT_COLOR,
-                          &radeon_font,
+                          psplash_font,
                           msg);
+
+    psplash_fb_flush_rect (fb, 0, 10, fb->width, h+10);
+
+    if (ncells <= PSPLASH_MSG_CELLS)
+    {
+        memcpy (msg_cells, cells, ncells * sizeof(PSplashTextCell));
+        msg_ncells = ncells;
+    }
+    else
+        msg_ncells = -1;
+    msg_height = h;
+    msg_bg     = bg;
+}
+
+// Infinite progress bar speed [px/s], xsplash carries on from the handed-off offset at the same speed
+#define INFINITE_PROGRESS_SPEED 100
+// How many times smaller the infinite bar is than its box
+#define INFINITE_PROGRESS_REL_SZ 4
+
+/*
+ * Columns [start, end) of the infinite bar at offset, clipped to the box.
+ * While entering (offset <= 0) the bar grows from the left edge of the box
+ * at twice the speed, its leading edge at barwidth + 2 * offset, as xsplash
+ * draws it. Both edges only move right as the offset grows.
+ */
+static void
+psplash_infinite_bar_span (int x, int width, int barwidth, int offset, int *start, int *end)
+{
+    if (offset <= 0)
+    {
+        *start = x;
+        *end   = CLAMP(x + barwidth + 2 * offset, x, x + width);
+    }
+    else
+    {
+        *start = CLAMP(x + offset, x, x + width);
+        *end   = CLAMP(x + offset + barwidth, x, x + width);
+    }
 }
 
 /*
  * IMPORTANT: keep appearance aligned with xsplash's draw_infinite_progress()
  * bar_rel_sz: how many times smaller is bar compared to background box
  * splash_progress: returned progress offset
+ *
+ * The offset follows the time elapsed since the first call, so the bar keeps
+ * its speed whatever the frame rate: late frames just show where it is now.
  */
 void
 psplash_draw_infinite_progress (PSplashFB *fb, int bar_rel_sz, int *progress)
@@ -92,8 +251,12 @@ psplash_draw_infinite_progress (PSplashFB *fb, int bar_rel_sz, int *progress)
     if (fb == NULL || bar_rel_sz <= 0 || progress == 0)
         return;
 
-    int x, y, width, height, barwidth, xoff;
-    static int step = 2;
+    int x, y, width, height, barwidth;
+    int old_start, old_end, new_start, new_end;
+    long now = psplash_now_ms();
+    static long start;
+    // offset of the bar on screen, INT_MIN when the box has to be repainted
+    static int drawn = INT_MIN;
 
     x      = (fb->width - BAR_IMG_WIDTH)/2;
     y      = fb->height - (fb->height/6);
@@ -102,27 +265,70 @@ psplash_draw_infinite_progress (PSplashFB *fb, int bar_rel_sz, int *progress)
 
     barwidth = (width + (bar_rel_sz-1)) / bar_rel_sz;  // equivalent to (width / bar_rel_sz) but rounded up
 
-    // wrap around
-    if (*progress == INT_MIN || (x + *progress) > (x + width))
-        *progress = -barwidth;
-    xoff = x + *progress;
+    if (*progress == INT_MIN)
+        start = now;
 
-    // draw background
-    psplash_fb_draw_rect (fb, 1, x, y, width, height, PSPLASH_BAR_BACKGROUND_COLOR);
+    // from -barwidth to width, then wrap around
+    *progress = -barwidth + (int)(((now - start) * INFINITE_PROGRESS_SPEED / 1000)
+                                  % (width + barwidth + 1));
+
+    if (*progress == drawn)
+        return;
 
-    // draw bar
-    int overflow = xoff + barwidth - (x + width);
-    if (overflow < 0)
-        overflow = 0;
-    if (*progress <= 0)
-      psplash_fb_draw_rect (fb, 1, xoff, y, barwidth + *progress, height, PSPLASH_BAR_COLOR);
+    psplash_infinite_bar_span(x, width, barwidth, *progress, &new_start, &new_end);
+
+    if (drawn == INT_MIN || *progress < drawn)
+    {
+        // draw background and bar, flushed together to avoid flickering
+        psplash_fb_draw_rect (fb, 1, x, y, width, height, PSPLASH_BAR_BACKGROUND_COLOR);
+        if (new_end > new_start)
+            psplash_fb_draw_rect (fb, 1, new_start, y, new_end - new_start, height, PSPLASH_BAR_COLOR);
+        psplash_fb_flush_rect (fb, x, y, width, height);
+    }
     else
-      psplash_fb_draw_rect (fb, 1, xoff, y, barwidth - overflow, height, PSPLASH_BAR_COLOR);
+    {
+        // only the edges moved: clear the trailing one, extend the leading one
+        psplash_infinite_bar_span(x, width, barwidth, drawn, &old_start, &old_end);
+
+        if (new_start > old_start)
+        {
+            int clear_end = MIN(old_end, new_start);
+
+            psplash_fb_draw_rect (fb, 1, old_start, y, clear_end - old_start, height, PSPLASH_BAR_BACKGROUND_COLOR);
+            psplash_fb_flush_rect (fb, old_start, y, clear_end - old_start, height);
+        }
+
+        if (new_end > old_end)
+        {
+            int fill_start = MAX(old_end, new_start);
+
+            psplash_fb_draw_rect (fb, 1, fill_start, y, new_end - fill_start, height, PSPLASH_BAR_COLOR);
+            psplash_fb_flush_rect (fb, fill_start, y, new_end - fill_start, height);
+        }
+    }
+
+    drawn = *progress;
+}
+
+/* Repaints columns [start, end) of the progress bar, bar colored over
+ * [bar_start, bar_end), and flushes them */
+static void
+psplash_draw_progress_span (PSplashFB *fb, int y, int height,
+                            int start, int end, int bar_start, int bar_end)
+{
+  if (end <= start)
+    return;
 
-    // use double buffering to avoid flickering due to overlapping rectangles
-    psplash_fb_flush_rect (fb, x, y, width, height);
+  psplash_fb_draw_rect (fb, 1, start, y, end - start, height,
+                        PSPLASH_BAR_BACKGROUND_COLOR);
 
-    *progress += step;
+  bar_start = MAX(bar_start, start);
+  bar_end   = MIN(bar_end, end);
+  if (bar_end > bar_start)
+    psplash_fb_draw_rect (fb, 1, bar_start, y, bar_end - bar_start, height,
+                          PSPLASH_BAR_COLOR);
+
+  psplash_fb_flush_rect (fb, start, y, end - start, height);
 }
 
 /*
@@ -135,229 +341,1037 @@ psplash_draw_progress (PSplashFB *fb, int value)
     return;
 
   int x, y, width, height, barwidth;
+  int start, end;
+  /* Bar columns on screen, drawn_end < 0 when the box has to be repainted */
+  static int drawn_start = 0, drawn_end = -1;
 
   x      = (fb->width  - BAR_IMG_WIDTH)/2;
   y      = fb->height - (fb->height/6) + 4;
   width  = BAR_IMG_WIDTH;
   height = BAR_IMG_HEIGHT;
 
+  /* Positive values fill from the left, negative ones from the right */
   if (value > 0)
     {
       barwidth = (CLAMP(value,0,100) * width) / 100;
-      psplash_fb_draw_rect (fb, 0, x + barwidth, y,
-    			width - barwidth, height,
-			PSPLASH_BAR_BACKGROUND_COLOR);
-      psplash_fb_draw_rect (fb, 0, x, y, barwidth,
-			    height, PSPLASH_BAR_COLOR);
+      start = x;
+      end   = x + barwidth;
     }
   else
     {
       barwidth = (CLAMP(-value,0,100) * width) / 100;
-      psplash_fb_draw_rect (fb, 0, x, y,
-    			width - barwidth, height,
-			PSPLASH_BAR_BACKGROUND_COLOR);
-      psplash_fb_draw_rect (fb, 0, x + width - barwidth,
-			    y, barwidth, height,
-			    PSPLASH_BAR_COLOR);
+      start = x + width - barwidth;
+      end   = x + width;
+    }
+
+  /* An empty bar has no position, so that only the other one matters */
+  if (start == end)
+    start = end = drawn_start;
+
+  if (drawn_end < 0)
+    psplash_draw_progress_span (fb, y, height, x, x + width, start, end);
+  else if (drawn_start == drawn_end)
+    psplash_draw_progress_span (fb, y, height, start, end, start, end);
+  else
+    {
+      /* Only the columns between the old and the new edges change */
+      psplash_draw_progress_span (fb, y, height, MIN(start, drawn_start),
+                                  MAX(start, drawn_start), start, end);
+      psplash_draw_progress_span (fb, y, height, MIN(end, drawn_end),
+                                  MAX(end, drawn_end), start, end);
     }
 
+  drawn_start = start;
+  drawn_end   = end;
+
   DBG("value: %i, width: %i, barwidth :%i\n", value,
 		width, barwidth);
 }
 
+/*
+ * Display state staged by the commands and drawn once per frame tick, so
+ * that a burst of commands costs no more than one frame to render
+ */
+typedef struct PSplashPending
+{
+  bool progress_set;
+  int  progress;
+  bool msg_set;
+  char msg[PSPLASH_CMD_LEN];
+  bool repaint;       /* the whole screen, after the VT or fb got clobbered */
+}
+PSplashPending;
+
+static bool
+psplash_pending (PSplashPending *pending)
+{
+  return pending->progress_set || pending->msg_set || pending->repaint;
+}
+
+static void
+psplash_apply_pending (PSplashFB *fb, PSplashPending *pending)
+{
+  if (pending->progress_set)
+    psplash_draw_progress (fb, pending->progress);
+
+  if (pending->msg_set)
+    psplash_draw_msg (fb, pending->msg);
+
+  /* Everything is drawn in the back buffer, which thus holds the scene */
+  if (pending->repaint)
+    psplash_fb_flush_rect (fb, 0, 0, fb->width, fb->height);
+
+  pending->progress_set = FALSE;
+  pending->msg_set      = FALSE;
+  pending->repaint      = FALSE;
+}
+
+/* Returns 1 on QUIT, -1 for a malformed or unknown command, 0 otherwise */
 static int
-parse_command (PSplashFB *fb, char *string, int length, bool infinite_progress, int progress)
+parse_command (PSplashPending *pending, char *string, int length, bool infinite_progress)
 {
-  char *command;
+  char *command, *arg;
 
   DBG("got cmd %s", string);
 	
+  /* The progress is left for the next stage by psplash_handoff() */
   if (strcmp(string, "QUIT") == 0)
+    return 1;
+
+  if (strcmp(string, "REPAINT") == 0)
     {
-    if (progress)
-      {
-        FILE* fp;
-        if ((fp = fopen(PROGRESS_FILE, "w")) == NULL)
-          {
-            fprintf(stderr, "Failed open progress file\n");
-            return 1;
-          }
-        fprintf(fp, "%d\n", progress);
-        (void) fclose(fp);
-      }
-      return 1;
+      pending->repaint = TRUE;
+      return 0;
     }
 
   command = strtok(string," ");
+  arg = strtok(NULL,"\0");
 
-  if (!infinite_progress && !strcmp(command,"PROGRESS"))
+  if (command == NULL || arg == NULL)
+    return -1;
+
+  if (!strcmp(command,"PROGRESS"))
     {
       int val;
-      if (atoi_s(strtok(NULL,"\0"), &val) == 0)
-        psplash_draw_progress (fb, val);
+      if (atoi_s(arg, &val))
+        return -1;
+      if (!infinite_progress)
+        {
+          pending->progress     = val;
+          pending->progress_set = TRUE;
+        }
     }
   else if (!strcmp(command,"MSG"))
     {
-      psplash_draw_msg (fb, strtok(NULL,"\0"));
+      strncpy (pending->msg, arg, sizeof(pending->msg) - 1);
+      pending->msg[sizeof(pending->msg) - 1] = '\0';
+      pending->msg_set = TRUE;
     }
+  else
+    return -1;
 
   return 0;
 }
 
+/*
+ * FIFO framing: writers may send several commands in one go, and a command
+ * may be split across reads. Every complete ('\0' or '\n' terminated)
+ * command is parsed as soon as it is read, the incomplete tail is carried
+ * over to the start of the buffer for the next read.
+ */
+typedef struct PSplashCmdBuf
+{
+  char   data[PSPLASH_CMD_LEN];
+  size_t len;
+}
+PSplashCmdBuf;
+
+/* Returns 1 on QUIT, -1 once all the writers are gone, 0 otherwise */
+static int
+psplash_fifo_read (PSplashPending *pending,
+                   int            pipe_fd,
+                   PSplashCmdBuf *buf,
+                   bool           infinite_progress)
+{
+  ssize_t n;
+  size_t  i, start = 0, end;
+
+  n = read (pipe_fd, buf->data + buf->len, sizeof(buf->data) - buf->len);
+
+  if (n < 0)
+    return 0;
+
+  end = buf->len + n;
+
+  if (n == 0)
+    {
+      /* A writer that went away terminates its last command */
+      if (buf->len == 0)
+        return -1;
+      buf->data[end++] = '\0';
+    }
+
+  for (i = buf->len; i < end; i++)
+    {
+      if (buf->data[i] != '\0' && buf->data[i] != '\n')
+        continue;
+
+      buf->data[i] = '\0';
+      if (i > start &&
+          parse_command(pending, buf->data + start, i - start, infinite_progress) > 0)
+        return 1;
+      start = i + 1;
+    }
+
+  buf->len = end - start;
+  if (start > 0 && buf->len > 0)
+    memmove (buf->data, buf->data + start, buf->len);
+
+  if (buf->len == sizeof(buf->data))
+    {
+      fprintf(stderr, "psplash: command too long, dropped\n");
+      buf->len = 0;
+    }
+
+  return (n == 0) ? -1 : 0;
+}
+
+/* Reads the boot options from the kernel command line */
+static void
+psplash_parse_cmdline (void)
+{
+    const char *fastboot = cmdline_get("fastboot");
+    int dispid;
+
+    if (fastboot && !strcmp(fastboot, "y"))
+    {
+        fprintf(stdout, "%s: fastboot=y\n", __func__);
+        fastboot_enable = TRUE;
+    } else {
+        fprintf(stdout, "%s: fastboot=n\n", __func__);
+        fastboot_enable = FALSE;
+    }
+    if (cmdline_get_int("hw_dispid", &dispid) == 0 && dispid == 122)
+    {
+        fprintf(stdout, "%s: hw_dispid=122\n", __func__);
+        wu16_machine = TRUE;
+    } else {
+        fprintf(stdout, "%s: hw_dispid!=122\n", __func__);
+        wu16_machine = FALSE;
+    }
+}
+
+/* Signal mask before psplash_signal_set() signals were blocked */
+static sigset_t orig_sigmask;
+
+/* Exit signals, handled by the main loop through a signalfd and blocked
+ * everywhere. SIGUSR1 (VT switches) is blocked everywhere but in the main
+ * thread, where vt_request() acknowledges it at once, even while the
+ * tap-tap menus keep the loop busy. */
+static void
+psplash_signal_set (sigset_t *set, bool vt_signal)
+{
+    sigemptyset(set);
+    sigaddset(set, SIGHUP);
+    sigaddset(set, SIGINT);
+    sigaddset(set, SIGQUIT);
+    if (vt_signal)
+        sigaddset(set, SIGUSR1);
+}
+
+/* Returns TRUE when one of the exit signals has been received */
+static bool
+psplash_handle_signals (int signal_fd)
+{
+    struct signalfd_siginfo si;
+
+    while (read(signal_fd, &si, sizeof(si)) == sizeof(si))
+    {
+        DBG("Exit Step #1");
+        sig_flag = 1;
+    }
+
+    return sig_flag;
+}
+
+static void
+psplash_epoll_add (int epoll_fd, int fd)
+{
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev))
+        perror("epoll_ctl");
+}
+
+/* One-shot timer, ms < 0 disarms it */
+static void
+psplash_set_timer (int timer_fd, int ms)
+{
+    struct itimerspec its;
+
+    memset(&its, 0, sizeof(its));
+    if (ms >= 0)
+    {
+        its.it_value.tv_sec  = ms / 1000;
+        its.it_value.tv_nsec = (ms % 1000) * 1000000L;
+        if (ms == 0)
+            its.it_value.tv_nsec = 1; // a zero it_value would disarm the timer
+    }
+
+    timerfd_settime(timer_fd, 0, &its, NULL);
+}
+
+/* Watches for the touch device to show up, after one more attempt to open it
+ * (which closes the race with its creation). Returns the watch fd, if needed */
+static int
+psplash_touch_watch (int epoll_fd, int *touch_fd)
+{
+    int watch_fd = Touch_watch_open();
+
+    if ((*touch_fd = Touch_open()) >= 0)
+    {
+        psplash_epoll_add(epoll_fd, *touch_fd);
+        if (watch_fd >= 0)
+            close(watch_fd);
+        return -1;
+    }
+
+    if (watch_fd >= 0)
+        psplash_epoll_add(epoll_fd, watch_fd);
+    return watch_fd;
+}
+
+/* Earliest of two delays, where -1 means none */
+#define PSPLASH_NEXT_DELAY(a, b) \
+   (((a) < 0) ? (b) : (((b) < 0 || (a) < (b)) ? (a) : (b)))
+
+#define PSPLASH_DEFAULT_FPS     50      // target frame rate while animating, see --fps
+#define PSPLASH_MIN_FPS         5       // the governor doesn't go below this
+#define PSPLASH_MAX_EVENTS      8
+
+/* Stages what producers changed in the shared-memory channel since the last
+ * frame: however often they write, only the latest state gets drawn */
+static void
+psplash_shm_update (PSplashPending *pending, PSplashShm *shm, PSplashShm *last, bool infinite_progress)
+{
+    PSplashShm snap;
+
+    if (!psplash_shm_snapshot(shm, &last->seq, &snap))
+        return;
+
+    if (!infinite_progress && snap.progress_seq != last->progress_seq)
+    {
+        pending->progress     = snap.progress;
+        pending->progress_set = TRUE;
+    }
+
+    if (snap.msg_seq != last->msg_seq)
+    {
+        memcpy(pending->msg, snap.msg, sizeof(snap.msg));
+        pending->msg[sizeof(snap.msg) - 1] = '\0';
+        pending->msg_set = TRUE;
+    }
+
+    last->progress_seq = snap.progress_seq;
+    last->msg_seq      = snap.msg_seq;
+}
+
+/* Serves the commands queued on a control connection, returns 1 on QUIT
+ * (not replied to yet). Accepted commands are answered by the next frame. */
+static int
+psplash_ctl_serve (PSplashPending   *pending,
+                   PSplashCtl       *ctl,
+                   PSplashCtlClient *client,
+                   bool              infinite_progress)
+{
+    char buf[PSPLASH_CMD_LEN];
+    int  len, ret;
+
+    // Commands aren't read while an error reply waits, only hangups get here
+    if (client->error)
+    {
+        psplash_ctl_drop(ctl, client);
+        return 0;
+    }
+
+    while ((len = psplash_ctl_recv(ctl, client, buf, sizeof(buf))) > 0)
+    {
+        // SYNC just waits for the frame, like everything else
+        if (!strcmp(buf, "SYNC"))
+        {
+            psplash_ctl_defer(ctl, client);
+            continue;
+        }
+
+        ret = parse_command(pending, buf, len, infinite_progress);
+        if (ret > 0)
+            return 1;
+
+        if (ret < 0)
+        {
+            psplash_ctl_reply(ctl, client, "bad command");
+            if (client->error)
+                break;
+        }
+        else
+            psplash_ctl_defer(ctl, client);
+    }
+
+    return 0;
+}
+
+/* Brings the next tick forward to ms from now, unless it's due earlier */
+static void
+psplash_advance_timer (int timer_fd, int ms)
+{
+    struct itimerspec its;
+
+    if (timerfd_gettime(timer_fd, &its) == 0 &&
+        (its.it_value.tv_sec || its.it_value.tv_nsec) &&
+        its.it_value.tv_sec * 1000L + its.it_value.tv_nsec / 1000000 <= ms)
+        return;
+
+    psplash_set_timer(timer_fd, ms);
+}
+
+/*
+ * Frame governor: frames are spaced by frame_ms while something animates
+ * (no timer at all otherwise). When frames take more than half of it to
+ * render, or start later than a whole frame, for a few frames in a row,
+ * the interval is doubled so that psplash backs off from a loaded system;
+ * it is halved again, down to the target, after a long run of cheap frames.
+ */
+#define PSPLASH_GOV_OVER_FRAMES     3
+#define PSPLASH_GOV_UNDER_FRAMES    50
+
+typedef struct PSplashGovernor
+{
+    int  target_ms;         // from the target FPS
+    int  frame_ms;          // current frame interval
+    long due;               // when the current tick was scheduled for
+    int  over;              // frames over budget in a row
+    int  under;             // frames well within budget in a row
+}
+PSplashGovernor;
+
+static void
+psplash_governor_init (PSplashGovernor *gov, int fps)
+{
+    memset(gov, 0, sizeof(*gov));
+    gov->target_ms = 1000 / CLAMP(fps, PSPLASH_MIN_FPS, 1000);
+    gov->frame_ms  = gov->target_ms;
+}
+
+/* Accounts for a frame run from start to end [ms] */
+static void
+psplash_governor_frame (PSplashGovernor *gov, long start, long end)
+{
+    long late   = (gov->due > 0) ? start - gov->due : 0;
+    long render = end - start;
+
+    if (render > gov->frame_ms / 2 || late > gov->frame_ms)
+    {
+        gov->under = 0;
+        if (++gov->over >= PSPLASH_GOV_OVER_FRAMES && gov->frame_ms < 1000 / PSPLASH_MIN_FPS)
+        {
+            gov->frame_ms = MIN(gov->frame_ms * 2, 1000 / PSPLASH_MIN_FPS);
+            gov->over = 0;
+            DBG("over budget (render %ld ms, late %ld ms): %i ms frames", render, late, gov->frame_ms);
+        }
+    }
+    else if (render <= gov->frame_ms / 4 && late <= gov->frame_ms / 4)
+    {
+        gov->over = 0;
+        if (++gov->under >= PSPLASH_GOV_UNDER_FRAMES && gov->frame_ms > gov->target_ms)
+        {
+            gov->frame_ms = MAX(gov->frame_ms / 2, gov->target_ms);
+            gov->under = 0;
+            DBG("within budget: %i ms frames", gov->frame_ms);
+        }
+    }
+}
+
+/*
+ * Leaves the state of the splash for the next stage: the infinite bar is
+ * moved to where it is now, so that the offset goes with the timestamp.
+ */
+static void
+psplash_handoff (PSplashFB *fb, PSplashPending *pending, bool infinite_progress, int *progress)
+{
+    PSplashHandoff rec;
+
+    memset(&rec, 0, sizeof(rec));
+
+    if (disable_progress_bar)
+        rec.mode = PSPLASH_HANDOFF_NONE;
+    else if (infinite_progress)
+    {
+        psplash_draw_infinite_progress(fb, INFINITE_PROGRESS_REL_SZ, progress);
+        rec.mode     = PSPLASH_HANDOFF_INFINITE;
+        rec.progress = *progress;
+        rec.speed    = INFINITE_PROGRESS_SPEED;
+    }
+    else
+    {
+        rec.mode     = PSPLASH_HANDOFF_DETERMINATE;
+        rec.progress = pending->progress;
+    }
+
+    rec.timestamp_ms = psplash_now_ms();
+
+    rec.bar_x      = (fb->width - BAR_IMG_WIDTH)/2;
+    rec.bar_y      = fb->height - (fb->height/6) + (infinite_progress ? 0 : 4);
+    rec.bar_width  = BAR_IMG_WIDTH;
+    rec.bar_height = BAR_IMG_HEIGHT;
+    rec.bar_size   = infinite_progress ?
+        (BAR_IMG_WIDTH + (INFINITE_PROGRESS_REL_SZ-1)) / INFINITE_PROGRESS_REL_SZ : 0;
+
+    rec.width   = fb->width;
+    rec.height  = fb->height;
+    rec.bpp     = fb->bpp;
+    rec.stride  = fb->stride;
+    rec.angle   = fb->angle;
+    rec.rgbmode = fb->rgbmode;
+
+    // The record keeps the start of a longer message
+    memcpy(rec.msg, pending->msg, strnlen(pending->msg, sizeof(rec.msg) - 1));
+
+    psplash_handoff_write(&rec);
+
+    // Older readers only know this one, it gets the same sample
+    if (*progress)
+    {
+        FILE* fp;
+        if ((fp = fopen(PROGRESS_FILE, "w")) == NULL)
+        {
+            fprintf(stderr, "Failed open progress file\n");
+            return;
+        }
+        fprintf(fp, "%d\n", *progress);
+        (void) fclose(fp);
+    }
+}
+
+/* When QUIT was parsed, zero if the main loop ended otherwise */
+static struct timespec quit_time;
+
 void
-psplash_main (PSplashFB *fb, int pipe_fd, bool disable_touch, bool infinite_progress)
+psplash_main (PSplashFB *fb, int pipe_fd, int ctl_fd, int touch_fd, bool disable_touch,
+              bool infinite_progress, PSplashShm *shm, int fps)
 {
     int            err;
-    ssize_t        length = 0;
-    fd_set         descriptors;
-    struct timeval tv;
-    char          *end;
-    char           command[2048];
+    PSplashCmdBuf  cmdbuf;
+    PSplashPending pending;
+    PSplashCtl     ctl;
+    PSplashCtlClient *client, *quitter = NULL;
+    long           last_frame = 0;
+    PSplashGovernor gov;
     int            taptap=0;
     int            laststatus=0;
-    int            touch_fd = -1;
     // Keep track of current progress so it can be passed to xsplash
     // currently supports infinite progress mode only
     int            progress = INT_MIN;
-    FILE* filePointer;
-    char buffer[255];
-
-    tv.tv_sec = 0;
-    tv.tv_usec = 40000;
+    // Delay [ms] before the next backlight fade step, -1 once done
+    int            fade_delay = 0;
+    // Shared-memory channel state drawn so far
+    PSplashShm     shm_last;
+    int            epoll_fd, timer_fd = -1, signal_fd = -1, watch_fd = -1;
+    int            i, nfds, delay;
+    long           now;
+    bool           tick;
+    sigset_t       sigmask;
+    uint64_t       expirations;
+    struct epoll_event events[PSPLASH_MAX_EVENTS];
+
+    cmdbuf.len = 0;
+    psplash_governor_init(&gov, fps);
+    memset(&pending, 0, sizeof(pending));
+    memset(&shm_last, 0, sizeof(shm_last));
+
+    if ((epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+    {
+        perror("epoll_create");
+        return;
+    }
 
-    FD_ZERO(&descriptors);
-    FD_SET(pipe_fd, &descriptors);
+    psplash_ctl_init(&ctl, epoll_fd, ctl_fd);
 
-    end = command;
+    // The startup threads are running with SIGUSR1 blocked, so it lands here
+    sigemptyset(&sigmask);
+    sigaddset(&sigmask, SIGUSR1);
+    pthread_sigmask(SIG_UNBLOCK, &sigmask, NULL);
 
-    filePointer = fopen("/proc/cmdline", "r");
-    if( fgets(buffer, sizeof(buffer), filePointer) )
+    psplash_signal_set(&sigmask, FALSE);
+    if ((signal_fd = signalfd(-1, &sigmask, SFD_NONBLOCK | SFD_CLOEXEC)) < 0 ||
+        (timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) < 0)
     {
-        if( strstr(buffer, "fastboot=y") )
-        {
-            fprintf(stdout, "%s: fastboot=y\n", __func__);
-            fastboot_enable = TRUE;
-        } else {
-            fprintf(stdout, "%s: fastboot=n\n", __func__);
-            fastboot_enable = FALSE;
-        }
-        if( strstr(buffer, "hw_dispid=122") )
-        {
-            fprintf(stdout, "%s: hw_dispid=122\n", __func__);
-            wu16_machine = TRUE;
-        } else {
-            fprintf(stdout, "%s: hw_dispid!=122\n", __func__);
-            wu16_machine = FALSE;
-        }
+        perror("signalfd/timerfd");
+        goto out;
     }
-    (void) fclose(filePointer);
+
+    psplash_epoll_add(epoll_fd, signal_fd);
+    psplash_epoll_add(epoll_fd, timer_fd);
+    psplash_epoll_add(epoll_fd, pipe_fd);
+    if (touch_fd >= 0)
+        psplash_epoll_add(epoll_fd, touch_fd);
+    else if (disable_touch == FALSE)
+        watch_fd = psplash_touch_watch(epoll_fd, &touch_fd);
+
+    // First tick right away, it arms the following ones as needed
+    psplash_set_timer(timer_fd, 0);
 
     while (1)
     {
-startloop:
-        // Handles tap-tap touchscreen sequence
-        if(touch_fd < 0 && disable_touch == FALSE)
-            touch_fd = Touch_open();
-
-        if(Touch_handler(touch_fd, &taptap, &laststatus))
+        nfds = epoll_wait(epoll_fd, events, PSPLASH_MAX_EVENTS, -1);
+        if (nfds < 0)
         {
-            TapTap_Progress(fb, taptap);
-            if(taptap > TAPTAP_TH)
+            if (errno != EINTR)
             {
-                if( FALSE == fastboot_enable || FALSE == wu16_machine)
-                    TapTap_Detected(touch_fd, fb, laststatus);
-                else
-                    FastBootTapTap_Detected(touch_fd, fb, laststatus);
-
-                return;
+                perror("epoll_wait");
+                break;
             }
+            nfds = 0;
         }
 
-        if (vt_requested())
-            return;
-
-        err = select(pipe_fd+1, &descriptors, NULL, NULL, &tv);
+        // vt_request() runs from the signal, interrupting the wait above
+        if (vt_requested() && !keep_on_vt_switch)
+            goto out;
 
-        if (err <= 0)
-        {
-            if(err==0)
-            { // This is the select(9 timeout case, needed only to handle the tap-tap sequence, so repeat the loop.
+        // Off screen while the VT is away, repainted whole once it is back
+        fb->hidden = !vt_visible();
+        if (vt_acquired())
+            pending.repaint = TRUE;
 
-                tv.tv_sec = 0;
-                tv.tv_usec = 20000;  // 40 ms repaint interval = 25fps
+        tick = FALSE;
 
-                FD_ZERO(&descriptors);
-                FD_SET(pipe_fd,&descriptors);
+        for (i = 0; i < nfds; i++)
+        {
+            int fd = events[i].data.fd;
 
-                if (infinite_progress)
-                    psplash_draw_infinite_progress(fb, 4, &progress);
+            if (fd == signal_fd)
+            {
+                if (psplash_handle_signals(signal_fd))
+                    goto out;
+            }
+            else if (fd == timer_fd)
+            {
+                if (read(timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations))
+                    tick = TRUE;
+            }
+            else if (fd == touch_fd)
+            {
+                if (events[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    // Device gone, wait for it to come back
+                    Touch_close(touch_fd);
+                    watch_fd = psplash_touch_watch(epoll_fd, &touch_fd);
+                    continue;
+                }
+
+                // Handles tap-tap touchscreen sequence
+                if(Touch_handler(touch_fd, &taptap, &laststatus))
+                {
+                    TapTap_Progress(fb, taptap);
+                    if(taptap > TAPTAP_TH)
+                    {
+                        Brightness_fade_finish();
+                        if( FALSE == fastboot_enable || FALSE == wu16_machine)
+                            TapTap_Detected(touch_fd, fb, laststatus);
+                        else
+                            FastBootTapTap_Detected(touch_fd, fb, laststatus);
+
+                        goto out;
+                    }
+                }
+            }
+            else if (fd == watch_fd)
+            {
+                if (Touch_watch_handler(watch_fd) && (touch_fd = Touch_open()) >= 0)
+                {
+                    psplash_epoll_add(epoll_fd, touch_fd);
+                    close(watch_fd);
+                    watch_fd = -1;
+                }
+            }
+            else if (fd == pipe_fd)
+            {
+                err = psplash_fifo_read(&pending, pipe_fd, &cmdbuf, infinite_progress);
+
+                if (err > 0)
+                    goto quit;
+
+                if (err < 0)
+                {
+                    /* Reopen to see if there's anything more for us */
+                    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, pipe_fd, NULL);
+                    close(pipe_fd);
+                    pipe_fd = open(PSPLASH_FIFO,O_RDONLY|O_NONBLOCK);
+                    if (pipe_fd < 0)
+                    {
+                        perror("pipe open");
+                        goto out;
+                    }
+                    psplash_epoll_add(epoll_fd, pipe_fd);
+                }
+            }
+            else if (fd == ctl_fd)
+            {
+                psplash_ctl_accept(&ctl);
+            }
+            else if ((client = psplash_ctl_client(&ctl, fd)) != NULL)
+            {
+                if (psplash_ctl_serve(&pending, &ctl, client, infinite_progress))
+                {
+                    quitter = client;
+                    goto quit;
+                }
+            }
+        }
 
-                goto startloop;
+        if (!tick)
+        {
+            // Something to show: no sooner than a frame after the last one
+            if (psplash_pending(&pending) || ctl.ndeferred > 0)
+            {
+                delay = last_frame + gov.frame_ms - psplash_now_ms();
+                psplash_advance_timer(timer_fd, (delay > 0) ? delay : 0);
             }
-            return;
+            continue;
         }
 
-        length += read (pipe_fd, end, sizeof(command) - (end - command));
+        last_frame = psplash_now_ms();
+        delay = -1;
 
-        if (length == 0)
+        // Backlight fade-in, stepped from here so that commands are still served meanwhile
+        if (fade_delay >= 0)
         {
-            /* Reopen to see if there's anything more for us */
-            close(pipe_fd);
-            pipe_fd = open(PSPLASH_FIFO,O_RDONLY|O_NONBLOCK);
-            goto out;
+            fade_delay = Brightness_fade_step();
+            if (fade_delay >= 0)
+                delay = PSPLASH_NEXT_DELAY(delay, MAX(fade_delay, gov.frame_ms));
         }
 
-        if (command[length-1] == '\0')
+        if (shm)
         {
-            if (parse_command(fb, command, strlen(command), infinite_progress, progress))
-                return;
-            length = 0;
+            psplash_shm_update(&pending, shm, &shm_last, infinite_progress);
+            delay = PSPLASH_NEXT_DELAY(delay, gov.frame_ms);
         }
-        else if (command[length-1] == '\n')
+
+        if (infinite_progress)
         {
-            command[length-1] = '\0';
-            if (parse_command(fb, command, strlen(command), infinite_progress, progress))
-                return;
-            length = 0;
+            psplash_draw_infinite_progress(fb, INFINITE_PROGRESS_REL_SZ, &progress);
+            delay = PSPLASH_NEXT_DELAY(delay, gov.frame_ms);
         }
 
+        psplash_apply_pending(fb, &pending);
+
+        // The frame is out, answer the commands it shows
+        psplash_ctl_frame_done(&ctl);
+
+        // Nothing left to animate: no timer until a command comes in
+        now = psplash_now_ms();
+        psplash_governor_frame(&gov, last_frame, now);
+        gov.due = (delay >= 0) ? now + delay : 0;
+        psplash_set_timer(timer_fd, delay);
+    }
+
+    goto out;
+
+quit:
+    clock_gettime(CLOCK_MONOTONIC, &quit_time);
+
+    // Whatever was accepted before QUIT still makes it to the screen
+    psplash_apply_pending(fb, &pending);
+    psplash_handoff(fb, &pending, infinite_progress, &progress);
+    psplash_ctl_frame_done(&ctl);
+    if (quitter)
+        psplash_ctl_reply(&ctl, quitter, NULL);
+
 out:
-        end = &command[length];
+    psplash_ctl_close(&ctl);
+    if (watch_fd >= 0)
+        close(watch_fd);
+    if (timer_fd >= 0)
+        close(timer_fd);
+    if (signal_fd >= 0)
+        close(signal_fd);
+    close(epoll_fd);
+}
+
+/* Startup stages, run concurrently by psplash_tasks_run() */
+typedef struct PSplashStartup
+{
+    int        angle;
+    bool       disable_console_switch;
+    bool       disable_touch;
+    bool       infinite_progress;
+    bool       blackscreen;
+    bool       shm;
+    int        threads;
+    int        fade_ms;
+    int        fade_curve;
+    int        fps;
+    const char *font;
+    PSplashFB *fb;
+    int        touch_fd;
+}
+PSplashStartup;
+
+static int
+startup_cmdline (void *data)
+{
+    gethwcode();
+    gettouchtype();
+    psplash_parse_cmdline();
+    return 0;
+}
+
+static int
+startup_console (void *data)
+{
+    PSplashStartup *startup = data;
+
+    if (!startup->disable_console_switch)
+        psplash_console_switch ();
+    return 0;
+}
+
+static int
+startup_fb (void *data)
+{
+    PSplashStartup *startup = data;
+    PSplashFB      *fb;
+
+    if ((fb = psplash_fb_new(startup->angle)) == NULL)
+        return -1;
+
+    /* Set the font size, based on the display resolution and screen orientation */
+    if(fb->width < USESMALLFONT_TH)
+        FONT_SCALE = 0; // Small fonts (scale = 1x)
+    else
+        FONT_SCALE = 1; // large fonts (scale = 2x)
+
+    startup->fb = fb;
+    return 0;
+}
 
-        tv.tv_sec = 0;
-        tv.tv_usec = 100000;
+static int
+startup_splash_load (void *data)
+{
+    PSplashStartup *startup = data;
+
+    if (startup->blackscreen)
+        return 0;
+
+    /* Failure is not fatal, the Poky logo is drawn instead */
+    psplash_load_custom_splashimage();
+    return 0;
+}
+
+static int
+startup_draw (void *data)
+{
+    PSplashStartup *startup = data;
+    PSplashFB      *fb = startup->fb;
+
+    if (fb == NULL)
+        return -1;
+
+    if(!startup->blackscreen)
+    {
+        /* Compose the first frame off-screen and copy it out in one go */
+
+        /* Clear the background with #ecece1 */
+        psplash_fb_draw_rect (fb, 1, 0, 0, fb->width, fb->height,
+                              PSPLASH_BACKGROUND_COLOR);
+
+        if(-1 == psplash_draw_custom_splashimage(fb, 1))
+        {
 
-        FD_ZERO(&descriptors);
-        FD_SET(pipe_fd,&descriptors);
+            /* Draw the Poky logo  */
+            psplash_fb_draw_image (fb, 1,
+                                   (fb->width  - POKY_IMG_WIDTH)/2,
+                                   ((fb->height * 5) / 6 - POKY_IMG_HEIGHT)/2,
+                                   POKY_IMG_WIDTH,
+                                   POKY_IMG_HEIGHT,
+                                   POKY_IMG_BYTES_PER_PIXEL,
+                                   POKY_IMG_RLE_PIXEL_DATA);
+        }
+
+        psplash_fb_flush_rect (fb, 0, 0, fb->width, fb->height);
+
+        if (!startup->infinite_progress)
+            psplash_draw_progress (fb, 0);
     }
+    return 0;
+}
 
-    return;
+static int
+startup_font (void *data)
+{
+    PSplashStartup *startup = data;
+
+    /* Keep the built-in font if the file can't be used */
+    if (startup->font && psplash_font_load(&loaded_font, startup->font) == 0)
+        psplash_font = &loaded_font;
+    return 0;
+}
+
+static int
+startup_brightness (void *data)
+{
+    return ReadBrightness();
+}
+
+static int
+startup_touch (void *data)
+{
+    PSplashStartup *startup = data;
+
+    if (!startup->disable_touch)
+        startup->touch_fd = Touch_open();
+    return 0;
+}
+
+/* Exit stages, also run concurrently: QUIT is only over once they are */
+typedef struct PSplashShutdown
+{
+    PSplashFB *fb;              /* NULL if the splash never made it up */
+    bool       console_reset;
+}
+PSplashShutdown;
+
+static int
+shutdown_fb (void *data)
+{
+    PSplashShutdown *shutdown = data;
+
+    if (shutdown->fb)
+        psplash_fb_destroy(shutdown->fb);
+    return 0;
+}
+
+/*
+ * Clears the boot counter from a child left running on its own: the write
+ * ends with a flush to the eMMC, which the exit doesn't have to wait for.
+ * Called once the exit stages are done and the pool threads are gone, so
+ * the child is forked from a single thread and the console and fb are
+ * already released.
+ */
+static void
+psplash_bootcounter_detach (void)
+{
+    pid_t pid = fork();
+    long  fd, max_fd;
+
+    if (pid == 0)
+    {
+        // Nothing of the parent is held past its exit, stdio aside
+        max_fd = sysconf(_SC_OPEN_MAX);
+        for (fd = STDERR_FILENO + 1; fd < max_fd; fd++)
+            close(fd);
+
+        sigprocmask(SIG_SETMASK, &orig_sigmask, NULL);
+        _exit(setbootcounter(0) ? 1 : 0);
+    }
+
+    // No child: the write can't be skipped, do it here
+    if (pid < 0)
+    {
+        perror("fork");
+        setbootcounter(0);
+    }
+}
+
+static int
+shutdown_console (void *data)
+{
+    PSplashShutdown *shutdown = data;
+
+    /* Returns once the switch back to the initial VT is done */
+    if (shutdown->console_reset)
+        psplash_console_reset();
+    return 0;
+}
+
+static int
+shutdown_color_params (void *data)
+{
+    return ColorMatrix_prepare() < 0;
+}
+
+static int
+shutdown_color_apply (void *data)
+{
+    return ColorMatrix_apply() < 0;
+}
+
+static void
+psplash_shutdown (PSplashFB *fb, bool console_reset)
+{
+    PSplashShutdown shutdown = { fb, console_reset };
+    PSplashTasks    tasks;
+    struct timespec start, end;
+    int             console_id, params_id;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (quit_time.tv_sec || quit_time.tv_nsec)
+        start = quit_time;
+
+    psplash_tasks_init(&tasks);
+    psplash_tasks_add(&tasks, "fb", shutdown_fb, &shutdown, 0);
+    console_id = psplash_tasks_add(&tasks, "console", shutdown_console, &shutdown, 0);
+    params_id  = psplash_tasks_add(&tasks, "color params", shutdown_color_params, &shutdown, 0);
+    /* The color correction goes to the display the VT is back on */
+    psplash_tasks_add(&tasks, "color apply", shutdown_color_apply, &shutdown,
+                      PSPLASH_TASK_DEP(console_id) | PSPLASH_TASK_DEP(params_id));
+    psplash_tasks_run(&tasks);
+    psplash_tasks_destroy(&tasks);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stderr, "psplash: exit took %ld us%s\n",
+            (end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000,
+            (quit_time.tv_sec || quit_time.tv_nsec) ? " from QUIT" : "");
 }
 
 int
 main (int argc, char** argv)
 {
     char      *tmpdir;
-    int        pipe_fd, i = 0, angle = 0, ret = 0;
+    int        pipe_fd, ctl_fd, i = 0, ret = 0;
+    int        cmdline_id, console_id, fb_id, splash_id;
     PSplashFB *fb;
-    bool       disable_console_switch = FALSE;
-    bool       disable_touch = FALSE;
-    bool       infinite_progress = FALSE;
-    bool       blackscreen = FALSE;
-
-    errno = 0;
-    if (signal(SIGHUP, psplash_exit) == SIG_ERR ||
-        signal(SIGINT, psplash_exit) == SIG_ERR ||
-        signal(SIGQUIT, psplash_exit) == SIG_ERR) {
-        perror("signal");
+    PSplashShm *shm = NULL;
+    PSplashStartup startup;
+    PSplashTasks   tasks;
+    sigset_t       sigmask;
+
+    memset(&startup, 0, sizeof(startup));
+    startup.touch_fd = -1;
+    startup.fade_ms = 1000;
+    startup.fade_curve = FADE_LINEAR;
+    startup.fps = PSPLASH_DEFAULT_FPS;
+    startup.font = getenv(PSPLASH_FONT_ENV);
+
+    /* Signals are only taken by the main thread: block them before any
+     * thread is started, so that every thread inherits the mask, and
+     * psplash_main() lets SIGUSR1 back in. The commands psplash runs get
+     * the original mask back. */
+    psplash_signal_set(&sigmask, TRUE);
+    if (sigprocmask(SIG_BLOCK, &sigmask, &orig_sigmask)) {
+        perror("sigprocmask");
         exit(-1);
     }
+    Spawn_set_sigmask(&orig_sigmask);
 
     while (++i < argc)
     {
         if (!strcmp(argv[i],"-n") || !strcmp(argv[i],"--no-console-switch"))
         {
-            disable_console_switch = TRUE;
+            startup.disable_console_switch = TRUE;
             continue;
         }
 
@@ -369,14 +1383,14 @@ main (int argc, char** argv)
 
         if (!strcmp(argv[i],"-xp") ||  !strcmp(argv[i],"--infinite-progress"))
         {
-            infinite_progress = TRUE;
+            startup.infinite_progress = TRUE;
             continue;
         }
 
         if (!strcmp(argv[i],"-a") || !strcmp(argv[i],"--angle"))
         {
             if (++i >= argc) goto fail;
-            if (atoi_s(argv[i], &angle)) {
+            if (atoi_s(argv[i], &startup.angle)) {
                 fprintf(stderr, "Bad angle value: %s!", argv[i]);
                 exit(-1);
             }
@@ -385,19 +1399,82 @@ main (int argc, char** argv)
 
         if (!strcmp(argv[i],"--notouch"))
         {
-            disable_touch = TRUE;
+            startup.disable_touch = TRUE;
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--keep-on-vt-switch"))
+        {
+            keep_on_vt_switch = TRUE;
             continue;
         }
 
         if (!strcmp(argv[i],"--blackscreen"))
         {
-            blackscreen = TRUE;
+            startup.blackscreen = TRUE;
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--shm"))
+        {
+            startup.shm = TRUE;
+            continue;
+        }
+
+        if (!strcmp(argv[i],"-j") || !strcmp(argv[i],"--threads"))
+        {
+            if (++i >= argc) goto fail;
+            if (atoi_s(argv[i], &startup.threads) || startup.threads < 0) {
+                fprintf(stderr, "Bad threads value: %s!", argv[i]);
+                exit(-1);
+            }
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--fade-ms"))
+        {
+            if (++i >= argc) goto fail;
+            if (atoi_s(argv[i], &startup.fade_ms) || startup.fade_ms < 0) {
+                fprintf(stderr, "Bad fade duration: %s!", argv[i]);
+                exit(-1);
+            }
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--fps"))
+        {
+            if (++i >= argc) goto fail;
+            if (atoi_s(argv[i], &startup.fps) || startup.fps < PSPLASH_MIN_FPS || startup.fps > 100) {
+                fprintf(stderr, "Bad frame rate: %s!", argv[i]);
+                exit(-1);
+            }
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--font"))
+        {
+            if (++i >= argc) goto fail;
+            startup.font = argv[i];
+            continue;
+        }
+
+        if (!strcmp(argv[i],"--fade-curve"))
+        {
+            if (++i >= argc) goto fail;
+            if (!strcmp(argv[i],"linear"))
+                startup.fade_curve = FADE_LINEAR;
+            else if (!strcmp(argv[i],"quadratic"))
+                startup.fade_curve = FADE_QUADRATIC;
+            else if (!strcmp(argv[i],"smooth"))
+                startup.fade_curve = FADE_SMOOTH;
+            else
+                goto fail;
             continue;
         }
 
 fail:
         fprintf(stderr,
-                "Usage: %s [-n|--no-console-switch][-a|--angle <0|90|180|270>][--notouch][-np|--no-progress-bar][-xp|--infinite-progress]\n",
+                "Usage: %s [-n|--no-console-switch][-a|--angle <0|90|180|270>][--notouch][--keep-on-vt-switch][--shm][-np|--no-progress-bar][-xp|--infinite-progress][-j|--threads <n>][--fade-ms <ms>][--fade-curve <linear|quadratic|smooth>][--fps <5..100>][--font <psf2 file>]\n",
                 argv[0]);
         exit(-1);
     }
@@ -430,66 +1507,68 @@ fail:
         exit(-2);
     }
 
-    if (!disable_console_switch)
-        psplash_console_switch ();
-
-    if ((fb = psplash_fb_new(angle)) == NULL) {
+    /* Control socket, commands with replies */
+    ctl_fd = psplash_ctl_listen();
+
+    /* Optional lock-free progress channel, polled once per frame */
+    if (startup.shm)
+        shm = psplash_shm_create();
+
+    /* Rendering workers, one per core unless told otherwise */
+    psplash_pool_init (startup.threads);
+
+    /* Bring up everything needed for the first frame, overlapping the
+     * independent stages so that only the longest chain is waited for */
+    psplash_tasks_init (&tasks);
+    cmdline_id = psplash_tasks_add (&tasks, "cmdline", startup_cmdline, &startup, 0);
+    console_id = psplash_tasks_add (&tasks, "console", startup_console, &startup, 0);
+    fb_id      = psplash_tasks_add (&tasks, "fb", startup_fb, &startup, 0);
+    splash_id  = psplash_tasks_add (&tasks, "splash", startup_splash_load, &startup, 0);
+    psplash_tasks_add (&tasks, "draw", startup_draw, &startup,
+                       PSPLASH_TASK_DEP(console_id) | PSPLASH_TASK_DEP(fb_id) |
+                       PSPLASH_TASK_DEP(splash_id));
+    psplash_tasks_add (&tasks, "font", startup_font, &startup, 0);
+    psplash_tasks_add (&tasks, "brightness", startup_brightness, &startup,
+                       PSPLASH_TASK_DEP(cmdline_id));
+    psplash_tasks_add (&tasks, "touch", startup_touch, &startup,
+                       PSPLASH_TASK_DEP(cmdline_id));
+    psplash_tasks_run (&tasks);
+    psplash_tasks_destroy (&tasks);
+
+    if ((fb = startup.fb) == NULL) {
+        Touch_close(startup.touch_fd);
         ret = -1;
         goto fb_fail;
     }
 
-    /* Set the font size, based on the display resolution and screen orientation */
-    if(fb->width < USESMALLFONT_TH)
-        FONT_SCALE = 0; // Small fonts (scale = 1x)
-    else
-        FONT_SCALE = 1; // large fonts (scale = 2x)
+    /* The fade itself is driven by the main loop */
+    Brightness_fade_start(startup.fade_ms, startup.fade_curve);
 
-    if(!blackscreen)
-    {
-        /* Clear the background with #ecece1 */
-        psplash_fb_draw_rect (fb, 0, 0, 0, fb->width, fb->height,
-                              PSPLASH_BACKGROUND_COLOR);
+    psplash_main (fb, pipe_fd, ctl_fd, startup.touch_fd, startup.disable_touch, startup.infinite_progress, shm, startup.fps);
 
-        if(-1 == psplash_draw_custom_splashimage(fb))
-        {
-
-            /* Draw the Poky logo  */
-            psplash_fb_draw_image (fb, 0,
-                                   (fb->width  - POKY_IMG_WIDTH)/2,
-                                   ((fb->height * 5) / 6 - POKY_IMG_HEIGHT)/2,
-                                   POKY_IMG_WIDTH,
-                                   POKY_IMG_HEIGHT,
-                                   POKY_IMG_BYTES_PER_PIXEL,
-                                   POKY_IMG_RLE_PIXEL_DATA);
-        }
-
-        if (!infinite_progress)
-            psplash_draw_progress (fb, 0);
-    }
-
-    UpdateBrightness();
-
-    psplash_main (fb, pipe_fd, disable_touch, infinite_progress);
+    Brightness_fade_finish();
 
     if (sig_flag)
-    {
         DBG("Exit Step #2");
-        psplash_console_reset ();
-    }
-
-    psplash_fb_destroy (fb);
-
-    // Clear the bootcounter
-    setbootcounter(0);
 
 fb_fail:
     unlink(PSPLASH_FIFO);
+    if (ctl_fd >= 0) {
+        close(ctl_fd);
+        unlink(PSPLASH_SOCKET);
+    }
+    psplash_shm_destroy(shm);
+
+    /* Instead of a fixed delay before the color correction, the console
+     * stage waits for the VT switch itself */
+    psplash_shutdown (fb, sig_flag || !startup.disable_console_switch);
 
-    if (!disable_console_switch)
-        psplash_console_reset ();
+    psplash_pool_destroy ();
 
-    usleep(1000000);
-    UpdateColorMatrix();
+    // Clear the bootcounter, once the splash has been up
+    if (fb)
+        psplash_bootcounter_detach();
+    psplash_font_unload (&loaded_font);
 
     return ret;
 }
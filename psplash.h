@@ -55,10 +55,21 @@ typedef int            bool;
 #endif
 
 #define PSPLASH_FIFO "psplash_fifo"
+#define PSPLASH_SOCKET "psplash_socket"
+/* Longest command, NUL included, over the FIFO as over the socket */
+#define PSPLASH_CMD_LEN 2048
 
 #define CLAMP(x, low, high) \
    (((x) > (high)) ? (high) : (((x) < (low)) ? (low) : (x)))
 
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
 #define DEBUG 0
 
 #if DEBUG
@@ -75,7 +86,10 @@ typedef struct PSplashFont
     int   index_mask;			/* ((1 << N) - 1). */
     int  *offset;			/* (1 << N) offsets into index. */
     int  *index;
-    u_int32_t *content;
+    uint8 *content;			/* Glyph rows, 1, 2 or 4 bytes each. */
+
+    /* Fonts loaded at run time (psplash-font.c) have no index/content */
+    struct PSplashFontFile *file;
 }
 PSplashFont;
 
@@ -1,41 +1,41 @@
 #include "psplash.h"
 
-/* Font generated from 'radeon' bdf font */
+/* Font generated from 'radeon' bdf font by make-font-header.py */
 
 /* Offsets into index. */
 static int _radon_offset[256] = {
-  569, /* (0x0) */
-  569, /* (0x1) */
-  569, /* (0x2) */
-  569, /* (0x3) */
-  569, /* (0x4) */
-  569, /* (0x5) */
-  569, /* (0x6) */
-  569, /* (0x7) */
-  569, /* (0x8) */
-  569, /* (0x9) */
-  569, /* (0xa) */
-  569, /* (0xb) */
-  569, /* (0xc) */
-  569, /* (0xd) */
-  569, /* (0xe) */
-  569, /* (0xf) */
-  569, /* (0x10) */
-  569, /* (0x11) */
-  569, /* (0x12) */
-  569, /* (0x13) */
-  569, /* (0x14) */
-  569, /* (0x15) */
-  569, /* (0x16) */
-  569, /* (0x17) */
-  569, /* (0x18) */
-  569, /* (0x19) */
-  569, /* (0x1a) */
-  569, /* (0x1b) */
-  569, /* (0x1c) */
-  569, /* (0x1d) */
-  569, /* (0x1e) */
-  569, /* (0x1f) */
+  570, /* (0x0) */
+  570, /* (0x1) */
+  570, /* (0x2) */
+  570, /* (0x3) */
+  570, /* (0x4) */
+  570, /* (0x5) */
+  570, /* (0x6) */
+  570, /* (0x7) */
+  570, /* (0x8) */
+  570, /* (0x9) */
+  570, /* (0xa) */
+  570, /* (0xb) */
+  570, /* (0xc) */
+  570, /* (0xd) */
+  570, /* (0xe) */
+  570, /* (0xf) */
+  570, /* (0x10) */
+  570, /* (0x11) */
+  570, /* (0x12) */
+  570, /* (0x13) */
+  570, /* (0x14) */
+  570, /* (0x15) */
+  570, /* (0x16) */
+  570, /* (0x17) */
+  570, /* (0x18) */
+  570, /* (0x19) */
+  570, /* (0x1a) */
+  570, /* (0x1b) */
+  570, /* (0x1c) */
+  570, /* (0x1d) */
+  570, /* (0x1e) */
+  570, /* (0x1f) */
   0, /* (0x20) */
   3, /* (0x21) */
   6, /* (0x22) */
@@ -131,39 +131,39 @@ static int _radon_offset[256] = {
   276, /* (0x7c) */
   279, /* (0x7d) */
   282, /* (0x7e) */
-  569, /* (0x7f) */
-  569, /* (0x80) */
-  569, /* (0x81) */
-  569, /* (0x82) */
-  569, /* (0x83) */
-  569, /* (0x84) */
-  569, /* (0x85) */
-  569, /* (0x86) */
-  569, /* (0x87) */
-  569, /* (0x88) */
-  569, /* (0x89) */
-  569, /* (0x8a) */
-  569, /* (0x8b) */
-  569, /* (0x8c) */
-  569, /* (0x8d) */
-  569, /* (0x8e) */
-  569, /* (0x8f) */
-  569, /* (0x90) */
-  569, /* (0x91) */
-  569, /* (0x92) */
-  569, /* (0x93) */
-  569, /* (0x94) */
-  569, /* (0x95) */
-  569, /* (0x96) */
-  569, /* (0x97) */
-  569, /* (0x98) */
-  569, /* (0x99) */
-  569, /* (0x9a) */
-  569, /* (0x9b) */
-  569, /* (0x9c) */
-  569, /* (0x9d) */
-  569, /* (0x9e) */
-  569, /* (0x9f) */
+  570, /* (0x7f) */
+  570, /* (0x80) */
+  570, /* (0x81) */
+  570, /* (0x82) */
+  570, /* (0x83) */
+  570, /* (0x84) */
+  570, /* (0x85) */
+  570, /* (0x86) */
+  570, /* (0x87) */
+  570, /* (0x88) */
+  570, /* (0x89) */
+  570, /* (0x8a) */
+  570, /* (0x8b) */
+  570, /* (0x8c) */
+  570, /* (0x8d) */
+  570, /* (0x8e) */
+  570, /* (0x8f) */
+  570, /* (0x90) */
+  570, /* (0x91) */
+  570, /* (0x92) */
+  570, /* (0x93) */
+  570, /* (0x94) */
+  570, /* (0x95) */
+  570, /* (0x96) */
+  570, /* (0x97) */
+  570, /* (0x98) */
+  570, /* (0x99) */
+  570, /* (0x9a) */
+  570, /* (0x9b) */
+  570, /* (0x9c) */
+  570, /* (0x9d) */
+  570, /* (0x9e) */
+  570, /* (0x9f) */
   285, /* (0xa0) */
   288, /* (0xa1) */
   291, /* (0xa2) */
@@ -259,11 +259,11 @@ static int _radon_offset[256] = {
   561, /* (0xfc) */
   564, /* (0xfd) */
   567, /* (0xfe) */
-  569, /* (0xff) */
+  570, /* (0xff) */
 };
 
 /* Index into content data. */
-static int _radon_index[570] = {
+static int _radon_index[571] = {
   0x8, 0,
   0,
   0x8, 12,
@@ -644,12 +644,13 @@ static int _radon_index[570] = {
   0,
   0x8, 2268,
   0,
+  0,
 };
 
 /* Font character content data. */
-static u_int32_t _radon_content[] = {
+static uint8 _radon_content[] = {
 
-/* 0: character   (0x20), width 8 */
+/* 0: character   (0x20), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -664,20 +665,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 12: character ! (0x21), width 8 */
+/* 12: character ! (0x21), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -692,20 +693,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 24: character " (0x22), width 8 */
+/* 24: character " (0x22), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  * *   |
@@ -720,20 +721,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x28000000,
-0x28000000,
-0x28000000,
-0x28000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x28,
+0x28,
+0x28,
+0x28,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 36: character # (0x23), width 8 */
+/* 36: character # (0x23), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *   *  |
@@ -748,20 +749,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x44000000,
-0x44000000,
-0xba000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0xba000000,
-0x44000000,
-0x44000000,
-0x00000000,
-0x00000000,
+0x00,
+0x44,
+0x44,
+0xba,
+0x44,
+0x44,
+0x44,
+0xba,
+0x44,
+0x44,
+0x00,
+0x00,
 
-/* 48: character $ (0x24), width 8 */
+/* 48: character $ (0x24), width 8, 1 byte(s) per row */
 /* +--------+
    |   *    |
    | ****** |
@@ -776,20 +777,20 @@ static u_int32_t _radon_content[] = {
    |   *    |
    |        |
    +--------+ */
-0x10000000,
-0x7e000000,
-0x80000000,
-0x90000000,
-0x80000000,
-0x7c000000,
-0x02000000,
-0x12000000,
-0x02000000,
-0xfc000000,
-0x10000000,
-0x00000000,
+0x10,
+0x7e,
+0x80,
+0x90,
+0x80,
+0x7c,
+0x02,
+0x12,
+0x02,
+0xfc,
+0x10,
+0x00,
 
-/* 60: character % (0x25), width 8 */
+/* 60: character % (0x25), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | **   * |
@@ -804,20 +805,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x62000000,
-0x92000000,
-0x94000000,
-0x68000000,
-0x10000000,
-0x2c000000,
-0x52000000,
-0x92000000,
-0x8c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x62,
+0x92,
+0x94,
+0x68,
+0x10,
+0x2c,
+0x52,
+0x92,
+0x8c,
+0x00,
+0x00,
 
-/* 72: character & (0x26), width 8 */
+/* 72: character & (0x26), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | **     |
@@ -832,20 +833,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x60000000,
-0x90000000,
-0x90000000,
-0x40000000,
-0x20000000,
-0x90000000,
-0x8a000000,
-0x84000000,
-0x7a000000,
-0x00000000,
-0x00000000,
+0x00,
+0x60,
+0x90,
+0x90,
+0x40,
+0x20,
+0x90,
+0x8a,
+0x84,
+0x7a,
+0x00,
+0x00,
 
-/* 84: character ' (0x27), width 8 */
+/* 84: character ' (0x27), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -860,20 +861,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x60000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x10,
+0x60,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 96: character ( (0x28), width 8 */
+/* 96: character ( (0x28), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |    *   |
@@ -888,20 +889,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x08000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x08,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x08,
+0x00,
+0x00,
 
-/* 108: character ) (0x29), width 8 */
+/* 108: character ) (0x29), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -916,20 +917,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x10,
+0x00,
+0x00,
 
-/* 120: character * (0x2a), width 8 */
+/* 120: character * (0x2a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -944,20 +945,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x92000000,
-0x54000000,
-0x10000000,
-0x10000000,
-0x54000000,
-0x92000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x92,
+0x54,
+0x10,
+0x10,
+0x54,
+0x92,
+0x10,
+0x00,
+0x00,
+0x00,
 
-/* 132: character + (0x2b), width 8 */
+/* 132: character + (0x2b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -972,20 +973,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0xd6000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x10,
+0x10,
+0x10,
+0xd6,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
+0x00,
 
-/* 144: character , (0x2c), width 8 */
+/* 144: character , (0x2c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1000,20 +1001,20 @@ static u_int32_t _radon_content[] = {
    |  **    |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x08000000,
-0x08000000,
-0x30000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x08,
+0x08,
+0x30,
+0x00,
 
-/* 156: character - (0x2d), width 8 */
+/* 156: character - (0x2d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1028,20 +1029,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0xfe,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 168: character . (0x2e), width 8 */
+/* 168: character . (0x2e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1056,20 +1057,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 180: character / (0x2f), width 8 */
+/* 180: character / (0x2f), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |      * |
@@ -1084,20 +1085,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x04000000,
-0x08000000,
-0x10000000,
-0x20000000,
-0x40000000,
-0x80000000,
-0x00000000,
-0x00000000,
+0x00,
+0x02,
+0x02,
+0x02,
+0x04,
+0x08,
+0x10,
+0x20,
+0x40,
+0x80,
+0x00,
+0x00,
 
-/* 192: character 0 (0x30), width 8 */
+/* 192: character 0 (0x30), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1112,20 +1113,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 204: character 1 (0x31), width 8 */
+/* 204: character 1 (0x31), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |    *   |
@@ -1140,20 +1141,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x08000000,
-0x28000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x08,
+0x28,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x00,
+0x00,
 
-/* 216: character 2 (0x32), width 8 */
+/* 216: character 2 (0x32), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******  |
@@ -1168,20 +1169,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfc000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfc,
+0x02,
+0x02,
+0x02,
+0x7c,
+0x80,
+0x80,
+0x00,
+0xfe,
+0x00,
+0x00,
 
-/* 228: character 3 (0x33), width 8 */
+/* 228: character 3 (0x33), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******  |
@@ -1196,20 +1197,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfc000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x3c000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0xfc000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfc,
+0x02,
+0x02,
+0x02,
+0x3c,
+0x02,
+0x02,
+0x02,
+0xfc,
+0x00,
+0x00,
 
-/* 240: character 4 (0x34), width 8 */
+/* 240: character 4 (0x34), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -1224,20 +1225,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7a000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7a,
+0x02,
+0x02,
+0x02,
+0x02,
+0x00,
+0x00,
 
-/* 252: character 5 (0x35), width 8 */
+/* 252: character 5 (0x35), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******* |
@@ -1252,20 +1253,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfe000000,
-0x00000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0xfc000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfe,
+0x00,
+0x80,
+0x80,
+0x7c,
+0x02,
+0x02,
+0x02,
+0xfc,
+0x00,
+0x00,
 
-/* 264: character 6 (0x36), width 8 */
+/* 264: character 6 (0x36), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1280,20 +1281,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x80,
+0x80,
+0xbc,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 276: character 7 (0x37), width 8 */
+/* 276: character 7 (0x37), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******  |
@@ -1308,20 +1309,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfc000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfc,
+0x02,
+0x02,
+0x02,
+0x02,
+0x02,
+0x02,
+0x02,
+0x02,
+0x00,
+0x00,
 
-/* 288: character 8 (0x38), width 8 */
+/* 288: character 8 (0x38), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1336,20 +1337,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 300: character 9 (0x39), width 8 */
+/* 300: character 9 (0x39), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1364,20 +1365,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7a000000,
-0x02000000,
-0x02000000,
-0xfc000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7a,
+0x02,
+0x02,
+0xfc,
+0x00,
+0x00,
 
-/* 312: character : (0x3a), width 8 */
+/* 312: character : (0x3a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1392,20 +1393,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x10,
+0x10,
+0x00,
+0x00,
+0x00,
+0x10,
+0x10,
+0x00,
+0x00,
+0x00,
 
-/* 324: character ; (0x3b), width 8 */
+/* 324: character ; (0x3b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1420,20 +1421,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x60000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x10,
+0x10,
+0x00,
+0x00,
+0x00,
+0x10,
+0x10,
+0x60,
+0x00,
+0x00,
 
-/* 336: character < (0x3c), width 8 */
+/* 336: character < (0x3c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |    *   |
@@ -1448,20 +1449,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x08000000,
-0x08000000,
-0x10000000,
-0x20000000,
-0x40000000,
-0x20000000,
-0x10000000,
-0x08000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x08,
+0x08,
+0x10,
+0x20,
+0x40,
+0x20,
+0x10,
+0x08,
+0x08,
+0x00,
+0x00,
 
-/* 348: character = (0x3d), width 8 */
+/* 348: character = (0x3d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -1476,20 +1477,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0xfe,
+0x00,
+0xfe,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 360: character > (0x3e), width 8 */
+/* 360: character > (0x3e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -1504,20 +1505,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x08000000,
-0x04000000,
-0x02000000,
-0x04000000,
-0x08000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x08,
+0x04,
+0x02,
+0x04,
+0x08,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 372: character ? (0x3f), width 8 */
+/* 372: character ? (0x3f), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******  |
@@ -1532,20 +1533,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfc000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x1c000000,
-0x20000000,
-0x20000000,
-0x00000000,
-0x20000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfc,
+0x02,
+0x02,
+0x02,
+0x1c,
+0x20,
+0x20,
+0x00,
+0x20,
+0x00,
+0x00,
 
-/* 384: character @ (0x40), width 8 */
+/* 384: character @ (0x40), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1560,20 +1561,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x8a000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x8c000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x8a,
+0x92,
+0x92,
+0x92,
+0x8c,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 396: character A (0x41), width 8 */
+/* 396: character A (0x41), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1588,20 +1589,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 408: character B (0x42), width 8 */
+/* 408: character B (0x42), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |* ****  |
@@ -1616,20 +1617,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x00000000,
-0x00000000,
+0x00,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x00,
+0x00,
 
-/* 420: character C (0x43), width 8 */
+/* 420: character C (0x43), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1644,20 +1645,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 432: character D (0x44), width 8 */
+/* 432: character D (0x44), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |* ****  |
@@ -1672,20 +1673,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x00000000,
-0x00000000,
+0x00,
+0xbc,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x00,
+0x00,
 
-/* 444: character E (0x45), width 8 */
+/* 444: character E (0x45), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1700,20 +1701,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x80,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 456: character F (0x46), width 8 */
+/* 456: character F (0x46), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1728,20 +1729,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x80,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x80,
+0x80,
+0x00,
+0x00,
 
-/* 468: character G (0x47), width 8 */
+/* 468: character G (0x47), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1756,20 +1757,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x9a000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x80,
+0x80,
+0x80,
+0x80,
+0x9a,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 480: character H (0x48), width 8 */
+/* 480: character H (0x48), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -1784,20 +1785,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 492: character I (0x49), width 8 */
+/* 492: character I (0x49), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -1812,20 +1813,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 504: character J (0x4a), width 8 */
+/* 504: character J (0x4a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |     *  |
@@ -1840,20 +1841,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x84000000,
-0x78000000,
-0x00000000,
-0x00000000,
+0x00,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x84,
+0x78,
+0x00,
+0x00,
 
-/* 516: character K (0x4b), width 8 */
+/* 516: character K (0x4b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -1868,20 +1869,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 528: character L (0x4c), width 8 */
+/* 528: character L (0x4c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*       |
@@ -1896,20 +1897,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x7e000000,
-0x00000000,
-0x00000000,
+0x00,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x7e,
+0x00,
+0x00,
 
-/* 540: character M (0x4d), width 8 */
+/* 540: character M (0x4d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1924,20 +1925,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x92,
+0x92,
+0x92,
+0x92,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 552: character N (0x4e), width 8 */
+/* 552: character N (0x4e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1952,20 +1953,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 564: character O (0x4f), width 8 */
+/* 564: character O (0x4f), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -1980,20 +1981,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 576: character P (0x50), width 8 */
+/* 576: character P (0x50), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |* ****  |
@@ -2008,20 +2009,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x00000000,
-0x00000000,
+0x00,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x80,
+0x80,
+0x80,
+0x80,
+0x00,
+0x00,
 
-/* 588: character Q (0x51), width 8 */
+/* 588: character Q (0x51), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -2036,20 +2037,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x8a000000,
-0x8a000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x8a,
+0x8a,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 600: character R (0x52), width 8 */
+/* 600: character R (0x52), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |* ****  |
@@ -2064,20 +2065,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 612: character S (0x53), width 8 */
+/* 612: character S (0x53), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | ****** |
@@ -2092,20 +2093,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7e000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0xfc000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7e,
+0x80,
+0x80,
+0x80,
+0x7c,
+0x02,
+0x02,
+0x02,
+0xfc,
+0x00,
+0x00,
 
-/* 624: character T (0x54), width 8 */
+/* 624: character T (0x54), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******* |
@@ -2120,20 +2121,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfe000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfe,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 636: character U (0x55), width 8 */
+/* 636: character U (0x55), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -2148,20 +2149,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 648: character V (0x56), width 8 */
+/* 648: character V (0x56), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -2176,20 +2177,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x84000000,
-0x88000000,
-0x90000000,
-0xa0000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x84,
+0x88,
+0x90,
+0xa0,
+0x00,
+0x00,
 
-/* 660: character W (0x57), width 8 */
+/* 660: character W (0x57), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -2204,20 +2205,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x92,
+0x92,
+0x92,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 672: character X (0x58), width 8 */
+/* 672: character X (0x58), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -2232,20 +2233,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 684: character Y (0x59), width 8 */
+/* 684: character Y (0x59), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -2260,20 +2261,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 696: character Z (0x5a), width 8 */
+/* 696: character Z (0x5a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |******  |
@@ -2288,20 +2289,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xfc000000,
-0x02000000,
-0x04000000,
-0x08000000,
-0x10000000,
-0x20000000,
-0x40000000,
-0x80000000,
-0x7e000000,
-0x00000000,
-0x00000000,
+0x00,
+0xfc,
+0x02,
+0x04,
+0x08,
+0x10,
+0x20,
+0x40,
+0x80,
+0x7e,
+0x00,
+0x00,
 
-/* 708: character [ (0x5b), width 8 */
+/* 708: character [ (0x5b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   ***  |
@@ -2316,20 +2317,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x1c000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x1c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x1c,
+0x20,
+0x20,
+0x20,
+0x20,
+0x20,
+0x20,
+0x20,
+0x1c,
+0x00,
+0x00,
 
-/* 720: character \ (0x5c), width 8 */
+/* 720: character \ (0x5c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*       |
@@ -2344,20 +2345,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x40000000,
-0x20000000,
-0x10000000,
-0x08000000,
-0x04000000,
-0x02000000,
-0x00000000,
-0x00000000,
+0x00,
+0x80,
+0x80,
+0x80,
+0x40,
+0x20,
+0x10,
+0x08,
+0x04,
+0x02,
+0x00,
+0x00,
 
-/* 732: character ] (0x5d), width 8 */
+/* 732: character ] (0x5d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  ***   |
@@ -2372,20 +2373,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x38000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x38000000,
-0x00000000,
-0x00000000,
+0x00,
+0x38,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x04,
+0x38,
+0x00,
+0x00,
 
-/* 744: character ^ (0x5e), width 8 */
+/* 744: character ^ (0x5e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  ***   |
@@ -2400,20 +2401,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x38000000,
-0x44000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x38,
+0x44,
+0x44,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 756: character _ (0x5f), width 8 */
+/* 756: character _ (0x5f), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2428,20 +2429,20 @@ static u_int32_t _radon_content[] = {
    |********|
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0xff000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0xff,
+0x00,
 
-/* 768: character ` (0x60), width 8 */
+/* 768: character ` (0x60), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |    *   |
@@ -2456,20 +2457,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x06000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x08,
+0x08,
+0x08,
+0x06,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 780: character a (0x61), width 8 */
+/* 780: character a (0x61), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2484,20 +2485,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 792: character b (0x62), width 8 */
+/* 792: character b (0x62), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2512,20 +2513,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x40000000,
-0x40000000,
-0x5c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x40,
+0x40,
+0x5c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 804: character c (0x63), width 8 */
+/* 804: character c (0x63), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2540,20 +2541,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x40000000,
-0x40000000,
-0x40000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x40,
+0x40,
+0x40,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 816: character d (0x64), width 8 */
+/* 816: character d (0x64), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2568,20 +2569,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x02000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x02,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 828: character e (0x65), width 8 */
+/* 828: character e (0x65), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2596,20 +2597,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 840: character f (0x66), width 8 */
+/* 840: character f (0x66), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2624,20 +2625,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x0c000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x54000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x0c,
+0x10,
+0x10,
+0x10,
+0x54,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 852: character g (0x67), width 8 */
+/* 852: character g (0x67), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2652,20 +2653,20 @@ static u_int32_t _radon_content[] = {
    |      * |
    |  ****  |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3a000000,
-0x02000000,
-0x3c000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3a,
+0x02,
+0x3c,
 
-/* 864: character h (0x68), width 8 */
+/* 864: character h (0x68), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2680,20 +2681,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x40000000,
-0x40000000,
-0x5c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x40,
+0x40,
+0x5c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x00,
+0x00,
 
-/* 876: character i (0x69), width 8 */
+/* 876: character i (0x69), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2708,20 +2709,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x08000000,
-0x00000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x08,
+0x00,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x00,
+0x00,
 
-/* 888: character j (0x6a), width 8 */
+/* 888: character j (0x6a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2736,20 +2737,20 @@ static u_int32_t _radon_content[] = {
    |    *   |
    |  **    |
    +--------+ */
-0x00000000,
-0x00000000,
-0x08000000,
-0x00000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x30000000,
+0x00,
+0x00,
+0x08,
+0x00,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x30,
 
-/* 900: character k (0x6b), width 8 */
+/* 900: character k (0x6b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2764,20 +2765,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x40000000,
-0x40000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x40,
+0x40,
+0x42,
+0x42,
+0x5c,
+0x42,
+0x42,
+0x42,
+0x00,
+0x00,
 
-/* 912: character l (0x6c), width 8 */
+/* 912: character l (0x6c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2792,20 +2793,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x08,
+0x00,
+0x00,
 
-/* 924: character m (0x6d), width 8 */
+/* 924: character m (0x6d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2820,20 +2821,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x7c,
+0x82,
+0x92,
+0x92,
+0x92,
+0x92,
+0x00,
+0x00,
 
-/* 936: character n (0x6e), width 8 */
+/* 936: character n (0x6e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2848,20 +2849,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x00,
+0x00,
 
-/* 948: character o (0x6f), width 8 */
+/* 948: character o (0x6f), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2876,20 +2877,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 960: character p (0x70), width 8 */
+/* 960: character p (0x70), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2904,20 +2905,20 @@ static u_int32_t _radon_content[] = {
    | *      |
    | *      |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x40000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x40,
 
-/* 972: character q (0x71), width 8 */
+/* 972: character q (0x71), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2932,20 +2933,20 @@ static u_int32_t _radon_content[] = {
    |      * |
    |      * |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3a000000,
-0x02000000,
-0x02000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3a,
+0x02,
+0x02,
 
-/* 984: character r (0x72), width 8 */
+/* 984: character r (0x72), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2960,20 +2961,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x0c000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x0c,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 996: character s (0x73), width 8 */
+/* 996: character s (0x73), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -2988,20 +2989,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3e000000,
-0x40000000,
-0x3c000000,
-0x02000000,
-0x02000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3e,
+0x40,
+0x3c,
+0x02,
+0x02,
+0x7c,
+0x00,
+0x00,
 
-/* 1008: character t (0x74), width 8 */
+/* 1008: character t (0x74), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3016,20 +3017,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x54000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x0c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x10,
+0x10,
+0x10,
+0x54,
+0x10,
+0x10,
+0x10,
+0x0c,
+0x00,
+0x00,
 
-/* 1020: character u (0x75), width 8 */
+/* 1020: character u (0x75), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3044,20 +3045,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1032: character v (0x76), width 8 */
+/* 1032: character v (0x76), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3072,20 +3073,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x44000000,
-0x48000000,
-0x50000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x44,
+0x48,
+0x50,
+0x00,
+0x00,
 
-/* 1044: character w (0x77), width 8 */
+/* 1044: character w (0x77), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3100,20 +3101,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x92000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x92,
+0x92,
+0x92,
+0x92,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1056: character x (0x78), width 8 */
+/* 1056: character x (0x78), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3128,20 +3129,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x42,
+0x42,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x00,
+0x00,
 
-/* 1068: character y (0x79), width 8 */
+/* 1068: character y (0x79), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3156,20 +3157,20 @@ static u_int32_t _radon_content[] = {
    |      * |
    |  ****  |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3a000000,
-0x02000000,
-0x3c000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3a,
+0x02,
+0x3c,
 
-/* 1080: character z (0x7a), width 8 */
+/* 1080: character z (0x7a), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3184,20 +3185,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x02000000,
-0x0c000000,
-0x30000000,
-0x40000000,
-0x3e000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x7c,
+0x02,
+0x0c,
+0x30,
+0x40,
+0x3e,
+0x00,
+0x00,
 
-/* 1092: character { (0x7b), width 8 */
+/* 1092: character { (0x7b), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   ***  |
@@ -3212,20 +3213,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x1c000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x40000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0x1c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x1c,
+0x20,
+0x20,
+0x20,
+0x40,
+0x20,
+0x20,
+0x20,
+0x1c,
+0x00,
+0x00,
 
-/* 1104: character | (0x7c), width 8 */
+/* 1104: character | (0x7c), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -3240,20 +3241,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1116: character } (0x7d), width 8 */
+/* 1116: character } (0x7d), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  ***   |
@@ -3268,20 +3269,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x38000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x02000000,
-0x04000000,
-0x04000000,
-0x04000000,
-0x38000000,
-0x00000000,
-0x00000000,
+0x00,
+0x38,
+0x04,
+0x04,
+0x04,
+0x02,
+0x04,
+0x04,
+0x04,
+0x38,
+0x00,
+0x00,
 
-/* 1128: character ~ (0x7e), width 8 */
+/* 1128: character ~ (0x7e), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |     *  |
@@ -3296,20 +3297,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x04000000,
-0x38000000,
-0x40000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x04,
+0x38,
+0x40,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1140: character   (0xa0), width 8 */
+/* 1140: character   (0xa0), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3324,20 +3325,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1152: character ¡ (0xa1), width 8 */
+/* 1152: character   (0xa1), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -3352,20 +3353,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1164: character ¢ (0xa2), width 8 */
+/* 1164: character   (0xa2), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3380,20 +3381,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x08000000,
-0x3e000000,
-0x40000000,
-0x48000000,
-0x48000000,
-0x40000000,
-0x3e000000,
-0x08000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x08,
+0x3e,
+0x40,
+0x48,
+0x48,
+0x40,
+0x3e,
+0x08,
+0x00,
+0x00,
 
-/* 1176: character £ (0xa3), width 8 */
+/* 1176: character   (0xa3), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   ***  |
@@ -3408,20 +3409,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x1c000000,
-0x20000000,
-0x20000000,
-0x20000000,
-0xa8000000,
-0x20000000,
-0x20000000,
-0x42000000,
-0xbc000000,
-0x00000000,
-0x00000000,
+0x00,
+0x1c,
+0x20,
+0x20,
+0x20,
+0xa8,
+0x20,
+0x20,
+0x42,
+0xbc,
+0x00,
+0x00,
 
-/* 1188: character ¤ (0xa4), width 8 */
+/* 1188: character   (0xa4), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3436,20 +3437,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x82000000,
-0x38000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x38000000,
-0x82000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x82,
+0x38,
+0x44,
+0x44,
+0x44,
+0x38,
+0x82,
+0x00,
+0x00,
+0x00,
 
-/* 1200: character ¥ (0xa5), width 8 */
+/* 1200: character   (0xa5), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*     * |
@@ -3464,20 +3465,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x54000000,
-0x10000000,
-0x54000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x54,
+0x10,
+0x54,
+0x10,
+0x00,
+0x00,
 
-/* 1212: character ¦ (0xa6), width 8 */
+/* 1212: character   (0xa6), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -3492,20 +3493,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
+0x00,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1224: character § (0xa7), width 8 */
+/* 1224: character   (0xa7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  ***   |
@@ -3520,20 +3521,20 @@ static u_int32_t _radon_content[] = {
    |  ***   |
    |        |
    +--------+ */
-0x00000000,
-0x38000000,
-0x40000000,
-0x38000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x38000000,
-0x04000000,
-0x38000000,
-0x00000000,
+0x00,
+0x38,
+0x40,
+0x38,
+0x44,
+0x44,
+0x44,
+0x44,
+0x38,
+0x04,
+0x38,
+0x00,
 
-/* 1236: character ¨ (0xa8), width 8 */
+/* 1236: character   (0xa8), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -3548,20 +3549,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1248: character © (0xa9), width 8 */
+/* 1248: character   (0xa9), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -3576,20 +3577,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x9a000000,
-0xa2000000,
-0xa2000000,
-0xa2000000,
-0x9a000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x9a,
+0xa2,
+0xa2,
+0xa2,
+0x9a,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1260: character ª (0xaa), width 8 */
+/* 1260: character   (0xaa), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    |     *  |
@@ -3604,20 +3605,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x04000000,
-0x34000000,
-0x44000000,
-0x38000000,
-0x00000000,
-0x7c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x38,
+0x04,
+0x34,
+0x44,
+0x38,
+0x00,
+0x7c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1272: character « (0xab), width 8 */
+/* 1272: character   (0xab), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3632,20 +3633,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x24000000,
-0x48000000,
-0x00000000,
-0x48000000,
-0x24000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x24,
+0x48,
+0x00,
+0x48,
+0x24,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1284: character ¬ (0xac), width 8 */
+/* 1284: character   (0xac), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3660,20 +3661,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0xfc000000,
-0x02000000,
-0x02000000,
-0x02000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0xfc,
+0x02,
+0x02,
+0x02,
+0x00,
+0x00,
+0x00,
 
-/* 1296: character ­ (0xad), width 8 */
+/* 1296: character   (0xad), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3688,20 +3689,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x7c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1308: character ® (0xae), width 8 */
+/* 1308: character   (0xae), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -3716,20 +3717,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x82000000,
-0x92000000,
-0xaa000000,
-0xb2000000,
-0xaa000000,
-0xaa000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7c,
+0x82,
+0x92,
+0xaa,
+0xb2,
+0xaa,
+0xaa,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1320: character ¯ (0xaf), width 8 */
+/* 1320: character   (0xaf), width 8, 1 byte(s) per row */
 /* +--------+
    | *****  |
    |        |
@@ -3744,20 +3745,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x7c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x7c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1332: character ° (0xb0), width 8 */
+/* 1332: character   (0xb0), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -3772,20 +3773,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x38000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x44,
+0x44,
+0x38,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1344: character ± (0xb1), width 8 */
+/* 1344: character   (0xb1), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   *    |
@@ -3800,20 +3801,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x10000000,
-0x10000000,
-0xd6000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x10,
+0x10,
+0xd6,
+0x10,
+0x10,
+0x00,
+0xfe,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1356: character ² (0xb2), width 8 */
+/* 1356: character   (0xb2), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    |     *  |
@@ -3828,20 +3829,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x04000000,
-0x18000000,
-0x20000000,
-0x3c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x38,
+0x04,
+0x18,
+0x20,
+0x3c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1368: character ³ (0xb3), width 8 */
+/* 1368: character   (0xb3), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    |     *  |
@@ -3856,20 +3857,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x04000000,
-0x38000000,
-0x04000000,
-0x38000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x38,
+0x04,
+0x38,
+0x04,
+0x38,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1380: character ´ (0xb4), width 8 */
+/* 1380: character   (0xb4), width 8, 1 byte(s) per row */
 /* +--------+
    |   **   |
    |  *     |
@@ -3884,20 +3885,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x18000000,
-0x20000000,
-0x20000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x18,
+0x20,
+0x20,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1392: character µ (0xb5), width 8 */
+/* 1392: character   (0xb5), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3912,20 +3913,20 @@ static u_int32_t _radon_content[] = {
    | *      |
    | *      |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x44000000,
-0x58000000,
-0x40000000,
-0x40000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x44,
+0x44,
+0x44,
+0x44,
+0x44,
+0x58,
+0x40,
+0x40,
 
-/* 1404: character ¶ (0xb6), width 8 */
+/* 1404: character   (0xb6), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | ****  *|
@@ -3940,20 +3941,20 @@ static u_int32_t _radon_content[] = {
    |    * * |
    |        |
    +--------+ */
-0x00000000,
-0x79000000,
-0xfa000000,
-0xfa000000,
-0xfa000000,
-0x7a000000,
-0x02000000,
-0x0a000000,
-0x0a000000,
-0x0a000000,
-0x0a000000,
-0x00000000,
+0x00,
+0x79,
+0xfa,
+0xfa,
+0xfa,
+0x7a,
+0x02,
+0x0a,
+0x0a,
+0x0a,
+0x0a,
+0x00,
 
-/* 1416: character · (0xb7), width 8 */
+/* 1416: character   (0xb7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3968,20 +3969,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x10,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1428: character ¸ (0xb8), width 8 */
+/* 1428: character   (0xb8), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -3996,20 +3997,20 @@ static u_int32_t _radon_content[] = {
    |   *    |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x08000000,
-0x10000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x08,
+0x10,
+0x00,
 
-/* 1440: character ¹ (0xb9), width 8 */
+/* 1440: character   (0xb9), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |   **   |
@@ -4024,20 +4025,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x18000000,
-0x08000000,
-0x08000000,
-0x08000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x08,
+0x18,
+0x08,
+0x08,
+0x08,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1452: character º (0xba), width 8 */
+/* 1452: character   (0xba), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4052,20 +4053,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x44000000,
-0x38000000,
-0x00000000,
-0x7c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x44,
+0x38,
+0x00,
+0x7c,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1464: character » (0xbb), width 8 */
+/* 1464: character   (0xbb), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -4080,20 +4081,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x48000000,
-0x24000000,
-0x00000000,
-0x24000000,
-0x48000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x48,
+0x24,
+0x00,
+0x24,
+0x48,
+0x00,
+0x00,
+0x00,
+0x00,
 
-/* 1476: character ¼ (0xbc), width 8 */
+/* 1476: character   (0xbc), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |* *   * |
@@ -4108,20 +4109,20 @@ static u_int32_t _radon_content[] = {
    |       *|
    |       *|
    +--------+ */
-0x20000000,
-0xa2000000,
-0x22000000,
-0x22000000,
-0x24000000,
-0x08000000,
-0x10000000,
-0x29000000,
-0x49000000,
-0x85000000,
-0x01000000,
-0x01000000,
-
-/* 1488: character ½ (0xbd), width 8 */
+0x20,
+0xa2,
+0x22,
+0x22,
+0x24,
+0x08,
+0x10,
+0x29,
+0x49,
+0x85,
+0x01,
+0x01,
+
+/* 1488: character   (0xbd), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |* *   * |
@@ -4136,20 +4137,20 @@ static u_int32_t _radon_content[] = {
    |    *   |
    |    ****|
    +--------+ */
-0x20000000,
-0xa2000000,
-0x22000000,
-0x22000000,
-0x24000000,
-0x08000000,
-0x10000000,
-0x2e000000,
-0x41000000,
-0x86000000,
-0x08000000,
-0x0f000000,
-
-/* 1500: character ¾ (0xbe), width 8 */
+0x20,
+0xa2,
+0x22,
+0x22,
+0x24,
+0x08,
+0x10,
+0x2e,
+0x41,
+0x86,
+0x08,
+0x0f,
+
+/* 1500: character   (0xbe), width 8, 1 byte(s) per row */
 /* +--------+
    |***     |
    |   *  * |
@@ -4164,20 +4165,20 @@ static u_int32_t _radon_content[] = {
    |       *|
    |       *|
    +--------+ */
-0xe0000000,
-0x12000000,
-0xe2000000,
-0x12000000,
-0xe4000000,
-0x08000000,
-0x10000000,
-0x29000000,
-0x49000000,
-0x85000000,
-0x01000000,
-0x01000000,
+0xe0,
+0x12,
+0xe2,
+0x12,
+0xe4,
+0x08,
+0x10,
+0x29,
+0x49,
+0x85,
+0x01,
+0x01,
 
-/* 1512: character ¿ (0xbf), width 8 */
+/* 1512: character   (0xbf), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |    *   |
@@ -4192,20 +4193,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x08000000,
-0x00000000,
-0x08000000,
-0x08000000,
-0x70000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x7e000000,
-0x00000000,
-0x00000000,
+0x00,
+0x08,
+0x00,
+0x08,
+0x08,
+0x70,
+0x80,
+0x80,
+0x80,
+0x7e,
+0x00,
+0x00,
 
-/* 1524: character À (0xc0), width 8 */
+/* 1524: character   (0xc0), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -4220,20 +4221,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1536: character Á (0xc1), width 8 */
+/* 1536: character   (0xc1), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -4248,20 +4249,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1548: character Â (0xc2), width 8 */
+/* 1548: character   (0xc2), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4276,20 +4277,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1560: character Ã (0xc3), width 8 */
+/* 1560: character   (0xc3), width 8, 1 byte(s) per row */
 /* +--------+
    |  **  * |
    | *  **  |
@@ -4304,20 +4305,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x32000000,
-0x4c000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x32,
+0x4c,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1572: character Ä (0xc4), width 8 */
+/* 1572: character   (0xc4), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -4332,20 +4333,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1584: character Å (0xc5), width 8 */
+/* 1584: character   (0xc5), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4360,20 +4361,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x38000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xba000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x38,
+0x7c,
+0x82,
+0x82,
+0x82,
+0xba,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1596: character Æ (0xc6), width 8 */
+/* 1596: character   (0xc6), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *** ***|
@@ -4388,20 +4389,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x77000000,
-0x88000000,
-0x88000000,
-0x88000000,
-0x8b000000,
-0xa8000000,
-0x88000000,
-0x88000000,
-0x8b000000,
-0x00000000,
-0x00000000,
+0x00,
+0x77,
+0x88,
+0x88,
+0x88,
+0x8b,
+0xa8,
+0x88,
+0x88,
+0x8b,
+0x00,
+0x00,
 
-/* 1608: character Ç (0xc7), width 8 */
+/* 1608: character   (0xc7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | *****  |
@@ -4416,20 +4417,20 @@ static u_int32_t _radon_content[] = {
    |   *    |
    |  *     |
    +--------+ */
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x80000000,
-0x6c000000,
-0x10000000,
-0x20000000,
-
-/* 1620: character È (0xc8), width 8 */
+0x00,
+0x7c,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x80,
+0x6c,
+0x10,
+0x20,
+
+/* 1620: character   (0xc8), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -4444,20 +4445,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x7c,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 1632: character É (0xc9), width 8 */
+/* 1632: character   (0xc9), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -4472,20 +4473,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x7c,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 1644: character Ê (0xca), width 8 */
+/* 1644: character   (0xca), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4500,20 +4501,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x7c,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 1656: character Ë (0xcb), width 8 */
+/* 1656: character   (0xcb), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -4528,20 +4529,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x80000000,
-0x80000000,
-0xb8000000,
-0x80000000,
-0x80000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x7c,
+0x80,
+0x80,
+0xb8,
+0x80,
+0x80,
+0x7c,
+0x00,
+0x00,
 
-/* 1668: character Ì (0xcc), width 8 */
+/* 1668: character   (0xcc), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -4556,20 +4557,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1680: character Í (0xcd), width 8 */
+/* 1680: character   (0xcd), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -4584,20 +4585,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1692: character Î (0xce), width 8 */
+/* 1692: character   (0xce), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4612,20 +4613,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1704: character Ï (0xcf), width 8 */
+/* 1704: character   (0xcf), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -4640,20 +4641,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1716: character Ð (0xd0), width 8 */
+/* 1716: character   (0xd0), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |* ****  |
@@ -4668,20 +4669,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xb2000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x00000000,
-0x00000000,
+0x00,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xb2,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x00,
+0x00,
 
-/* 1728: character Ñ (0xd1), width 8 */
+/* 1728: character   (0xd1), width 8, 1 byte(s) per row */
 /* +--------+
    |  **  * |
    | *  **  |
@@ -4696,20 +4697,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x32000000,
-0x4c000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x00000000,
-0x00000000,
+0x32,
+0x4c,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x00,
+0x00,
 
-/* 1740: character Ò (0xd2), width 8 */
+/* 1740: character   (0xd2), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -4724,20 +4725,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1752: character Ó (0xd3), width 8 */
+/* 1752: character   (0xd3), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -4752,20 +4753,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1764: character Ô (0xd4), width 8 */
+/* 1764: character   (0xd4), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4780,20 +4781,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1776: character Õ (0xd5), width 8 */
+/* 1776: character   (0xd5), width 8, 1 byte(s) per row */
 /* +--------+
    |  **  * |
    | *  **  |
@@ -4808,20 +4809,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x32000000,
-0x4c000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x32,
+0x4c,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1788: character Ö (0xd6), width 8 */
+/* 1788: character   (0xd6), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -4836,20 +4837,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x7c000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x7c,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1800: character × (0xd7), width 8 */
+/* 1800: character   (0xd7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -4864,20 +4865,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x44000000,
-0x28000000,
-0x00000000,
-0x28000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x44,
+0x28,
+0x00,
+0x28,
+0x44,
+0x00,
+0x00,
+0x00,
 
-/* 1812: character Ø (0xd8), width 8 */
+/* 1812: character   (0xd8), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    | **** * |
@@ -4892,20 +4893,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x7a000000,
-0x84000000,
-0x82000000,
-0x8a000000,
-0x92000000,
-0xa2000000,
-0x82000000,
-0x42000000,
-0xbc000000,
-0x00000000,
-0x00000000,
+0x00,
+0x7a,
+0x84,
+0x82,
+0x8a,
+0x92,
+0xa2,
+0x82,
+0x42,
+0xbc,
+0x00,
+0x00,
 
-/* 1824: character Ù (0xd9), width 8 */
+/* 1824: character   (0xd9), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -4920,20 +4921,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1836: character Ú (0xda), width 8 */
+/* 1836: character   (0xda), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -4948,20 +4949,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1848: character Û (0xdb), width 8 */
+/* 1848: character   (0xdb), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -4976,20 +4977,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1860: character Ü (0xdc), width 8 */
+/* 1860: character   (0xdc), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5004,20 +5005,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x00,
 
-/* 1872: character Ý (0xdd), width 8 */
+/* 1872: character   (0xdd), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |* **  * |
@@ -5032,20 +5033,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0xb2000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0x7c000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x08,
+0xb2,
+0x82,
+0x82,
+0x82,
+0x7c,
+0x00,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 1884: character Þ (0xde), width 8 */
+/* 1884: character   (0xde), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*       |
@@ -5060,20 +5061,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x80000000,
-0x80000000,
-0xbc000000,
-0x82000000,
-0x82000000,
-0x82000000,
-0xbc000000,
-0x80000000,
-0x80000000,
-0x00000000,
-0x00000000,
+0x00,
+0x80,
+0x80,
+0xbc,
+0x82,
+0x82,
+0x82,
+0xbc,
+0x80,
+0x80,
+0x00,
+0x00,
 
-/* 1896: character ß (0xdf), width 8 */
+/* 1896: character   (0xdf), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  ****  |
@@ -5088,20 +5089,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x9c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x5c,
+0x42,
+0x42,
+0x42,
+0x9c,
+0x00,
+0x00,
 
-/* 1908: character à (0xe0), width 8 */
+/* 1908: character   (0xe0), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -5116,20 +5117,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1920: character á (0xe1), width 8 */
+/* 1920: character   (0xe1), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -5144,20 +5145,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1932: character â (0xe2), width 8 */
+/* 1932: character   (0xe2), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -5172,20 +5173,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1944: character ã (0xe3), width 8 */
+/* 1944: character   (0xe3), width 8, 1 byte(s) per row */
 /* +--------+
    |  **  * |
    | *  **  |
@@ -5200,20 +5201,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x32000000,
-0x4c000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x32,
+0x4c,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1956: character ä (0xe4), width 8 */
+/* 1956: character   (0xe4), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5228,20 +5229,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1968: character å (0xe5), width 8 */
+/* 1968: character   (0xe5), width 8, 1 byte(s) per row */
 /* +--------+
    |   **   |
    |  *  *  |
@@ -5256,20 +5257,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x18000000,
-0x24000000,
-0x18000000,
-0x00000000,
-0x3c000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x18,
+0x24,
+0x18,
+0x00,
+0x3c,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 1980: character æ (0xe6), width 8 */
+/* 1980: character   (0xe6), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -5284,20 +5285,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x6c000000,
-0x12000000,
-0x52000000,
-0x94000000,
-0x90000000,
-0x6e000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x6c,
+0x12,
+0x52,
+0x94,
+0x90,
+0x6e,
+0x00,
+0x00,
 
-/* 1992: character ç (0xe7), width 8 */
+/* 1992: character   (0xe7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -5312,20 +5313,20 @@ static u_int32_t _radon_content[] = {
    |    *   |
    |   *    |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x40000000,
-0x40000000,
-0x40000000,
-0x40000000,
-0x34000000,
-0x08000000,
-0x10000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x40,
+0x40,
+0x40,
+0x40,
+0x34,
+0x08,
+0x10,
 
-/* 2004: character è (0xe8), width 8 */
+/* 2004: character   (0xe8), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -5340,20 +5341,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 2016: character é (0xe9), width 8 */
+/* 2016: character   (0xe9), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -5368,20 +5369,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 2028: character ê (0xea), width 8 */
+/* 2028: character   (0xea), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -5396,20 +5397,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 2040: character ë (0xeb), width 8 */
+/* 2040: character   (0xeb), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5424,20 +5425,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x5c000000,
-0x40000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x5c,
+0x40,
+0x3c,
+0x00,
+0x00,
 
-/* 2052: character ì (0xec), width 8 */
+/* 2052: character   (0xec), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -5452,20 +5453,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 2064: character í (0xed), width 8 */
+/* 2064: character   (0xed), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -5480,20 +5481,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 2076: character î (0xee), width 8 */
+/* 2076: character   (0xee), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -5508,20 +5509,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 2088: character ï (0xef), width 8 */
+/* 2088: character   (0xef), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5536,20 +5537,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x10000000,
-0x00000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x10000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x10,
+0x00,
+0x10,
+0x10,
+0x10,
+0x10,
+0x10,
+0x00,
+0x00,
 
-/* 2100: character ð (0xf0), width 8 */
+/* 2100: character   (0xf0), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |   * *  |
@@ -5564,20 +5565,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x14000000,
-0x08000000,
-0x14000000,
-0x02000000,
-0x3a000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x14,
+0x08,
+0x14,
+0x02,
+0x3a,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2112: character ñ (0xf1), width 8 */
+/* 2112: character   (0xf1), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |  **  * |
@@ -5592,20 +5593,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x32000000,
-0x4c000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x00000000,
-0x00000000,
+0x00,
+0x32,
+0x4c,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x00,
+0x00,
 
-/* 2124: character ò (0xf2), width 8 */
+/* 2124: character   (0xf2), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -5620,20 +5621,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2136: character ó (0xf3), width 8 */
+/* 2136: character   (0xf3), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -5648,20 +5649,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2148: character ô (0xf4), width 8 */
+/* 2148: character   (0xf4), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -5676,20 +5677,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2160: character õ (0xf5), width 8 */
+/* 2160: character   (0xf5), width 8, 1 byte(s) per row */
 /* +--------+
    |  **  * |
    | *  **  |
@@ -5704,20 +5705,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x32000000,
-0x4c000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x32,
+0x4c,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2172: character ö (0xf6), width 8 */
+/* 2172: character   (0xf6), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5732,20 +5733,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3c000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x00,
+0x3c,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2184: character ÷ (0xf7), width 8 */
+/* 2184: character   (0xf7), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -5760,20 +5761,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x38000000,
-0x00000000,
-0xfe000000,
-0x00000000,
-0x38000000,
-0x00000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x38,
+0x00,
+0xfe,
+0x00,
+0x38,
+0x00,
+0x00,
+0x00,
 
-/* 2196: character ø (0xf8), width 8 */
+/* 2196: character   (0xf8), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |        |
@@ -5788,20 +5789,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x3a000000,
-0x44000000,
-0x4a000000,
-0x52000000,
-0x22000000,
-0x5c000000,
-0x00000000,
-0x00000000,
+0x00,
+0x00,
+0x00,
+0x00,
+0x3a,
+0x44,
+0x4a,
+0x52,
+0x22,
+0x5c,
+0x00,
+0x00,
 
-/* 2208: character ù (0xf9), width 8 */
+/* 2208: character   (0xf9), width 8, 1 byte(s) per row */
 /* +--------+
    |  *     |
    |   **   |
@@ -5816,20 +5817,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x20000000,
-0x18000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x20,
+0x18,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2220: character ú (0xfa), width 8 */
+/* 2220: character   (0xfa), width 8, 1 byte(s) per row */
 /* +--------+
    |    *   |
    |  **    |
@@ -5844,20 +5845,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x08000000,
-0x30000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x08,
+0x30,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2232: character û (0xfb), width 8 */
+/* 2232: character   (0xfb), width 8, 1 byte(s) per row */
 /* +--------+
    |  ***   |
    | *   *  |
@@ -5872,20 +5873,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x38000000,
-0x44000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x38,
+0x44,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2244: character ü (0xfc), width 8 */
+/* 2244: character   (0xfc), width 8, 1 byte(s) per row */
 /* +--------+
    | ** **  |
    |        |
@@ -5900,20 +5901,20 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x6c000000,
-0x00000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3c000000,
-0x00000000,
-0x00000000,
+0x6c,
+0x00,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3c,
+0x00,
+0x00,
 
-/* 2256: character ý (0xfd), width 8 */
+/* 2256: character   (0xfd), width 8, 1 byte(s) per row */
 /* +--------+
    |     *  |
    |   **   |
@@ -5928,20 +5929,20 @@ static u_int32_t _radon_content[] = {
    |      * |
    |  ****  |
    +--------+ */
-0x04000000,
-0x18000000,
-0x00000000,
-0x00000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x42000000,
-0x3a000000,
-0x02000000,
-0x3c000000,
+0x04,
+0x18,
+0x00,
+0x00,
+0x42,
+0x42,
+0x42,
+0x42,
+0x42,
+0x3a,
+0x02,
+0x3c,
 
-/* 2268: character þ (0xfe), width 8 */
+/* 2268: character   (0xfe), width 8, 1 byte(s) per row */
 /* +--------+
    |        |
    |*       |
@@ -5956,18 +5957,18 @@ static u_int32_t _radon_content[] = {
    |        |
    |        |
    +--------+ */
-0x00000000,
-0x80000000,
-0x80000000,
-0x9c000000,
-0xa2000000,
-0x82000000,
-0xa2000000,
-0x9c000000,
-0x80000000,
-0x80000000,
-0x00000000,
-0x00000000,
+0x00,
+0x80,
+0x80,
+0x9c,
+0xa2,
+0x82,
+0xa2,
+0x9c,
+0x80,
+0x80,
+0x00,
+0x00,
 
 };
 
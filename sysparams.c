@@ -0,0 +1,224 @@
+/*
+ *  In-process reader for the system parameter store (system.ini).
+ *
+ *  Copyright (C) 2026 Exor s.p.a.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#include "sysparams.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * The file is mapped once and kept mapped: the index holds the normalized
+ * "section/key" names, values point straight into the mapping.
+ * Nested keys may be written either as a/b or as a\b (QSettings style), and
+ * keys of the [General] section have no section prefix.
+ */
+typedef struct SysParam
+{
+  const char* key;
+  const char* value;
+  int         value_len;
+} SysParam;
+
+static const char* ini_data = NULL;
+static size_t      ini_size = 0;
+static SysParam*   params = NULL;
+static int         nparams = 0;
+static char*       keys = NULL;
+static int         loaded = 0;
+
+static int param_cmp(const void* a, const void* b)
+{
+  return strcmp(((const SysParam*)a)->key, ((const SysParam*)b)->key);
+}
+
+static int is_blank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Helper function to build the index of all the keys in the mapped file
+static int sysparams_index()
+{
+  const char* p = ini_data;
+  const char* end = ini_data + ini_size;
+  const char* line_end;
+  const char* section = NULL;
+  int         section_len = 0;
+  int         maxparams = 1;
+  size_t      maxline = 0;
+  char*       k;
+
+  // Upper bounds for index and key storage: one entry per line, each one
+  // holding at most a copy of the section name (not longer than a line)
+  for (p = ini_data; p < end; p = line_end + 1)
+  {
+    line_end = memchr(p, '\n', end - p);
+    if (line_end == NULL)
+      line_end = end;
+    if ((size_t)(line_end - p) > maxline)
+      maxline = line_end - p;
+    maxparams++;
+  }
+
+  params = (SysParam*) malloc(maxparams * sizeof(SysParam));
+  keys = k = (char*) malloc(ini_size + maxparams * (maxline + 2));
+  if (params == NULL || keys == NULL)
+    return -1;
+
+  for (p = ini_data; p < end; )
+  {
+    const char* line = p;
+    const char* eol = memchr(p, '\n', end - p);
+    const char* eq;
+
+    if (eol == NULL)
+      eol = end;
+    p = eol + 1;
+
+    while (line < eol && is_blank(*line))
+      line++;
+    while (eol > line && is_blank(eol[-1]))
+      eol--;
+
+    if (line == eol || *line == ';' || *line == '#')
+      continue;
+
+    if (*line == '[')
+    {
+      section = line + 1;
+      section_len = 0;
+      while (section + section_len < eol && section[section_len] != ']')
+        section_len++;
+      if (section_len == 7 && !strncmp(section, "General", 7))
+        section_len = 0;
+      continue;
+    }
+
+    if ((eq = memchr(line, '=', eol - line)) == NULL)
+      continue;
+
+    // Normalized key: section/key with '\' separators turned into '/'
+    SysParam* param = &params[nparams++];
+    const char* kend = eq;
+    const char* c;
+
+    while (kend > line && is_blank(kend[-1]))
+      kend--;
+
+    param->key = k;
+    if (section_len)
+    {
+      memcpy(k, section, section_len);
+      k += section_len;
+      *k++ = '/';
+    }
+    for (c = line; c < kend; c++)
+      *k++ = (*c == '\\') ? '/' : *c;
+    *k++ = '\0';
+
+    // Value, without surrounding blanks and quotes
+    c = eq + 1;
+    while (c < eol && is_blank(*c))
+      c++;
+    if (eol - c >= 2 && *c == '"' && eol[-1] == '"')
+    {
+      c++;
+      param->value_len = eol - c - 1;
+    }
+    else
+      param->value_len = eol - c;
+    param->value = c;
+  }
+
+  qsort(params, nparams, sizeof(SysParam), param_cmp);
+  return 0;
+}
+
+int sysparams_load()
+{
+  struct stat st;
+  char* path;
+  int fd;
+
+  if (loaded)
+    return (ini_data != NULL) ? 0 : -1;
+  loaded = 1;
+
+  path = getenv("SYSTEMINI");
+  if (path == NULL)
+    path = SYSTEMINI_FILE;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return -1;
+
+  if (fstat(fd, &st) || st.st_size <= 0)
+  {
+    close(fd);
+    return -1;
+  }
+
+  ini_data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (ini_data == MAP_FAILED)
+  {
+    ini_data = NULL;
+    return -1;
+  }
+  ini_size = st.st_size;
+
+  if (sysparams_index())
+  {
+    fprintf(stderr, "sysparams: cannot index %s\n", path);
+    free(params);
+    free(keys);
+    params = NULL;
+    keys = NULL;
+    nparams = 0;
+    munmap((void*)ini_data, ini_size);
+    ini_data = NULL;
+    return -1;
+  }
+
+  return 0;
+}
+
+int sysparams_get(const char* key, char* value, int n)
+{
+  SysParam  wanted;
+  SysParam* found;
+  int       len;
+
+  if (sysparams_load() || n < 1)
+    return -1;
+
+  wanted.key = key;
+  found = bsearch(&wanted, params, nparams, sizeof(SysParam), param_cmp);
+  if (found == NULL)
+    return -1;
+
+  len = found->value_len;
+  if (len > n - 1)
+    len = n - 1;
+  memcpy(value, found->value, len);
+  value[len] = '\0';
+
+  return 0;
+}
@@ -0,0 +1,30 @@
+/*
+ *  In-process reader for the system parameter store (system.ini).
+ *
+ *  Copyright (C) 2026 Exor s.p.a.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2, or (at your option)
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ */
+
+#ifndef _HAVE_SYSPARAMS_H
+#define _HAVE_SYSPARAMS_H
+
+// Default location of the store, can be overridden with the SYSTEMINI env. variable
+#define SYSTEMINI_FILE          "/etc/system.ini"
+
+// Loads and indexes the store (done once, on first use): 0 on success, -1 if not available
+int sysparams_load();
+
+// Copies the value of "section/key" (nested keys separated by '/') into value: 0 on success, -1 if not found
+int sysparams_get(const char* key, char* value, int n);
+
+#endif